@@ -21,6 +21,496 @@
 
 #include "FreeTypeGX.h"
 
+#include <algorithm>
+#include <math.h>
+#include <stdarg.h>
+#include <stdio.h>
+
+#ifdef GEKKO
+#include <ogc/lwp_watchdog.h>
+#else
+#include <time.h>
+#include <unistd.h>
+#endif
+
+/**
+ * Orders glyph quads by the texture atlas page they sample.
+ */
+static bool compareGlyphQuadPage(const ftgxGlyphQuad &a, const ftgxGlyphQuad &b) {
+	return a.texturePage < b.texturePage;
+}
+
+/**
+ * Orders queued quads by point size.
+ */
+static bool compareQueuedQuadSize(const ftgxQueuedQuad &a, const ftgxQueuedQuad &b) {
+	return a.fontSize->sizeSerial < b.fontSize->sizeSerial;
+}
+
+/**
+ * Orders queued quads by point size and then by color.
+ */
+static bool compareQueuedQuadSizeColor(const ftgxQueuedQuad &a, const ftgxQueuedQuad &b) {
+	if(a.fontSize->sizeSerial != b.fontSize->sizeSerial) {
+		return a.fontSize->sizeSerial < b.fontSize->sizeSerial;
+	}
+
+	return *(uint32_t *)&a.glyphQuad.quadColor < *(uint32_t *)&b.glyphQuad.quadColor;
+}
+
+/**
+ * Creates a reader over a NULL terminated wide text string.
+ */
+static inline ftgxTextReader wideTextReader(const wchar_t *text) {
+	ftgxTextReader reader = { text, NULL, NULL };
+	return reader;
+}
+
+/**
+ * Creates a reader over a UTF-8 text string of the given length in bytes, or FTGX_TEXT_TERMINATED if NULL terminated.
+ */
+static inline ftgxTextReader utf8TextReader(const char *text, uint32_t length) {
+	ftgxTextReader reader = { NULL, (const uint8_t *)text, length != FTGX_TEXT_TERMINATED ? (const uint8_t *)text + length : NULL };
+	return reader;
+}
+
+/**
+ * Reads the next character of a text string, decoding UTF-8 sequences in place.
+ * 
+ * Malformed, overlong and surrogate UTF-8 sequences are read as U+FFFD. Zero is returned at the end of the string.
+ */
+static inline wchar_t readCharacter(ftgxTextReader *reader) {
+	if(reader->wideText != NULL) {
+		return *reader->wideText ? *reader->wideText++ : 0;
+	}
+
+	const uint8_t *text = reader->utf8Text;
+	if(text == reader->utf8End || *text == 0) {
+		return 0;
+	}
+
+	uint32_t character = *text++;
+	if(character >= 0x80) {
+		static const uint32_t minimumValue[4] = { 0, 0x80, 0x800, 0x10000 };
+		uint8_t continuation = character >= 0xf0 ? 3 : (character >= 0xe0 ? 2 : (character >= 0xc0 ? 1 : 0));
+
+		if(continuation == 0 || character >= 0xf8) {
+			character = 0xfffd;
+		}
+		else {
+			character &= 0x3f >> continuation;
+			for(uint8_t i = 0; i < continuation; i++) {
+				if(text == reader->utf8End || (*text & 0xc0) != 0x80) {
+					character = 0xfffd;
+					break;
+				}
+				character = (character << 6) | (*text++ & 0x3f);
+			}
+
+			if(character < minimumValue[continuation] || character > 0x10ffff || (character >= 0xd800 && character < 0xe000)) {
+				character = 0xfffd;
+			}
+		}
+	}
+
+	reader->utf8Text = text;
+	return character;
+}
+
+/**
+ * Formats an unsigned integer as decimal digits ending at the end of a buffer.
+ * 
+ * @return The number of digits written before bufferEnd.
+ */
+static uint8_t formatDigits(char *bufferEnd, uint32_t value, uint8_t minDigits) {
+	uint8_t digits = 0;
+
+	do {
+		*--bufferEnd = '0' + value % 10;
+		value /= 10;
+		digits++;
+	} while(value != 0 || digits < minDigits);
+
+	return digits;
+}
+
+/**
+ * Replaces a distance field point by its neighbor's seed pixel should that be nearer.
+ */
+static inline void compareFieldPoint(ftgxFieldPoint *point, ftgxFieldPoint neighbor, int16_t offsetX, int16_t offsetY) {
+	neighbor.offsetX += offsetX;
+	neighbor.offsetY += offsetY;
+
+	if(neighbor.offsetX * neighbor.offsetX + neighbor.offsetY * neighbor.offsetY < point->offsetX * point->offsetX + point->offsetY * point->offsetY) {
+		*point = neighbor;
+	}
+}
+
+/**
+ * Propagates the nearest seed pixel across a distance field with a forward and a backward pass over its rows.
+ */
+static void propagateDistanceField(ftgxFieldPoint *field, int32_t width, int32_t height) {
+	for(int32_t y = 0; y < height; y++) {
+		ftgxFieldPoint *row = field + y * width;
+
+		for(int32_t x = 0; x < width; x++) {
+			if(x > 0) {
+				compareFieldPoint(&row[x], row[x - 1], -1, 0);
+			}
+			if(y > 0) {
+				compareFieldPoint(&row[x], row[x - width], 0, -1);
+				if(x > 0) {
+					compareFieldPoint(&row[x], row[x - width - 1], -1, -1);
+				}
+				if(x < width - 1) {
+					compareFieldPoint(&row[x], row[x - width + 1], 1, -1);
+				}
+			}
+		}
+		for(int32_t x = width - 2; x >= 0; x--) {
+			compareFieldPoint(&row[x], row[x + 1], 1, 0);
+		}
+	}
+
+	for(int32_t y = height - 1; y >= 0; y--) {
+		ftgxFieldPoint *row = field + y * width;
+
+		for(int32_t x = width - 1; x >= 0; x--) {
+			if(x < width - 1) {
+				compareFieldPoint(&row[x], row[x + 1], 1, 0);
+			}
+			if(y < height - 1) {
+				compareFieldPoint(&row[x], row[x + width], 0, 1);
+				if(x > 0) {
+					compareFieldPoint(&row[x], row[x + width - 1], -1, 1);
+				}
+				if(x < width - 1) {
+					compareFieldPoint(&row[x], row[x + width + 1], 1, 1);
+				}
+			}
+		}
+		for(int32_t x = 1; x < width; x++) {
+			compareFieldPoint(&row[x], row[x - 1], -1, 0);
+		}
+	}
+}
+
+/**
+ * Builds the metrics of a glyph held by a FreeType glyph slot.
+ * 
+ * @param glyph	The glyph slot holding the loaded glyph.
+ * @param gIndex	The glyph's index within the font face.
+ * @param textureHeight	Height of the glyph texture in pixels including its padding.
+ * @param bitmapTop	Distance from the baseline to the top of the glyph bitmap in pixels.
+ * @param padding	Padding surrounding the glyph bitmap on each side of its texture in pixels.
+ * @return The metrics of the glyph.
+ */
+static ftgxCharData buildGlyphMetrics(FT_GlyphSlot glyph, FT_UInt gIndex, uint16_t textureHeight, int16_t bitmapTop, uint16_t padding) {
+	ftgxCharData charData;
+
+	charData.glyphAdvanceX = (uint32_t)glyph->advance.x;
+	charData.glyphIndex = (uint16_t)gIndex;
+	charData.renderOffsetY = (uint16_t)(bitmapTop + padding);
+	charData.renderOffsetMax = (uint16_t)bitmapTop;
+	charData.renderOffsetMin = (uint16_t)(textureHeight - (padding << 1) - bitmapTop);
+
+	return charData;
+}
+
+/**
+ * Orders kerning pairs by their glyph pair.
+ */
+static bool compareKerningPair(const ftgxKerningPair &a, const ftgxKerningPair &b) {
+	return a.glyphPair < b.glyphPair;
+}
+
+/**
+ * Saturates a kerning adjustment in 26.6 fixed point pixels to the range of a kerning table entry.
+ */
+static inline int16_t clampKerning(FT_Pos kerningX) {
+	return (int16_t)std::max<FT_Pos>(-0x8000, std::min<FT_Pos>(kerningX, 0x7fff));
+}
+
+/**
+ * Reads a big endian 16-bit value from a font table or font cache buffer.
+ */
+static inline uint16_t readTableUInt16(const FT_Byte *table) {
+	return (table[0] << 8) | table[1];
+}
+
+/**
+ * Reads a big endian 32-bit value from a font table or font cache buffer.
+ */
+static inline uint32_t readTableUInt32(const FT_Byte *table) {
+	return ((uint32_t)table[0] << 24) | ((uint32_t)table[1] << 16) | ((uint32_t)table[2] << 8) | table[3];
+}
+
+/**
+ * Reads a big endian IEEE 754 single precision value from a font cache buffer.
+ */
+static inline f32 readTableFloat(const FT_Byte *table) {
+	uint32_t bits = readTableUInt32(table);
+	f32 value;
+
+	memcpy(&value, &bits, sizeof(value));
+	return value;
+}
+
+/**
+ * Writes a big endian 16-bit value into a font cache buffer.
+ */
+static inline void writeTableUInt16(FT_Byte *table, uint16_t value) {
+	table[0] = value >> 8;
+	table[1] = value & 0xff;
+}
+
+/**
+ * Writes a big endian 32-bit value into a font cache buffer.
+ */
+static inline void writeTableUInt32(FT_Byte *table, uint32_t value) {
+	table[0] = value >> 24;
+	table[1] = (value >> 16) & 0xff;
+	table[2] = (value >> 8) & 0xff;
+	table[3] = value & 0xff;
+}
+
+/**
+ * Writes a big endian IEEE 754 single precision value into a font cache buffer.
+ */
+static inline void writeTableFloat(FT_Byte *table, f32 value) {
+	uint32_t bits;
+
+	memcpy(&bits, &value, sizeof(bits));
+	writeTableUInt32(table, bits);
+}
+
+/**
+ * Reads the header record of a font cache buffer.
+ */
+static void readCacheHeader(const FT_Byte *record, ftgxCacheHeader *header) {
+	header->cacheMagic = readTableUInt32(record);
+	header->cacheVersion = readTableUInt16(record + 4);
+	header->textureFormat = readTableUInt16(record + 6);
+	header->pointSize = readTableUInt16(record + 8);
+	header->ascender = (int16_t)readTableUInt16(record + 10);
+	header->descender = (int16_t)readTableUInt16(record + 12);
+	header->notdefSlot = readTableUInt16(record + 14);
+	header->glyphCount = readTableUInt16(record + 16);
+	header->pageCount = readTableUInt16(record + 18);
+	header->texturePadding = readTableUInt16(record + 20);
+	header->solidSlot = readTableUInt16(record + 22);
+	header->charCount = readTableUInt32(record + 24);
+	header->kerningCount = readTableUInt32(record + 28);
+	header->cacheFlags = readTableUInt16(record + 32);
+}
+
+/**
+ * Writes the header record of a font cache buffer.
+ */
+static void writeCacheHeader(FT_Byte *record, const ftgxCacheHeader *header) {
+	writeTableUInt32(record, header->cacheMagic);
+	writeTableUInt16(record + 4, header->cacheVersion);
+	writeTableUInt16(record + 6, header->textureFormat);
+	writeTableUInt16(record + 8, header->pointSize);
+	writeTableUInt16(record + 10, (uint16_t)header->ascender);
+	writeTableUInt16(record + 12, (uint16_t)header->descender);
+	writeTableUInt16(record + 14, header->notdefSlot);
+	writeTableUInt16(record + 16, header->glyphCount);
+	writeTableUInt16(record + 18, header->pageCount);
+	writeTableUInt16(record + 20, header->texturePadding);
+	writeTableUInt16(record + 22, header->solidSlot);
+	writeTableUInt32(record + 24, header->charCount);
+	writeTableUInt32(record + 28, header->kerningCount);
+	writeTableUInt16(record + 32, header->cacheFlags);
+}
+
+/**
+ * Reads a glyph record of a font cache buffer.
+ */
+static void readCacheGlyph(const FT_Byte *record, ftgxCharData *charData, ftgxCharTexture *charTexture) {
+	charData->glyphAdvanceX = readTableUInt32(record);
+	charData->glyphIndex = readTableUInt16(record + 4);
+	charData->renderOffsetY = readTableUInt16(record + 6);
+	charData->renderOffsetMax = readTableUInt16(record + 8);
+	charData->renderOffsetMin = readTableUInt16(record + 10);
+	charTexture->textureWidth = readTableUInt16(record + 12);
+	charTexture->textureHeight = readTableUInt16(record + 14);
+	charTexture->texturePage = readTableUInt16(record + 16);
+	charTexture->textureCoordLeft = readTableFloat(record + 20);
+	charTexture->textureCoordTop = readTableFloat(record + 24);
+	charTexture->textureCoordRight = readTableFloat(record + 28);
+	charTexture->textureCoordBottom = readTableFloat(record + 32);
+}
+
+/**
+ * Writes a glyph record of a font cache buffer.
+ */
+static void writeCacheGlyph(FT_Byte *record, const ftgxCharData *charData, const ftgxCharTexture *charTexture) {
+	writeTableUInt32(record, charData->glyphAdvanceX);
+	writeTableUInt16(record + 4, charData->glyphIndex);
+	writeTableUInt16(record + 6, charData->renderOffsetY);
+	writeTableUInt16(record + 8, charData->renderOffsetMax);
+	writeTableUInt16(record + 10, charData->renderOffsetMin);
+	writeTableUInt16(record + 12, charTexture->textureWidth);
+	writeTableUInt16(record + 14, charTexture->textureHeight);
+	writeTableUInt16(record + 16, charTexture->texturePage);
+	writeTableFloat(record + 20, charTexture->textureCoordLeft);
+	writeTableFloat(record + 24, charTexture->textureCoordTop);
+	writeTableFloat(record + 28, charTexture->textureCoordRight);
+	writeTableFloat(record + 32, charTexture->textureCoordBottom);
+}
+
+/**
+ * Starts a worker thread using the threading library of the target system.
+ */
+static bool startThread(ftgxThread *thread, void *(*entry)(void *), void *arg) {
+#ifdef GEKKO
+	return LWP_CreateThread(thread, entry, arg, NULL, FTGX_RASTER_STACK_SIZE, LWP_PRIO_NORMAL) >= 0;
+#else
+	pthread_attr_t attr;
+	pthread_attr_init(&attr);
+	pthread_attr_setstacksize(&attr, FTGX_RASTER_STACK_SIZE < PTHREAD_STACK_MIN ? PTHREAD_STACK_MIN : FTGX_RASTER_STACK_SIZE);
+	bool started = pthread_create(thread, &attr, entry, arg) == 0;
+	pthread_attr_destroy(&attr);
+	return started;
+#endif
+}
+
+/**
+ * Waits for a worker thread started with startThread to finish.
+ */
+static void joinThread(ftgxThread thread) {
+#ifdef GEKKO
+	LWP_JoinThread(thread, NULL);
+#else
+	pthread_join(thread, NULL);
+#endif
+}
+
+/**
+ * Initializes a mutex using the threading library of the target system.
+ */
+static void initMutex(ftgxMutex *mutex) {
+#ifdef GEKKO
+	LWP_MutexInit(mutex, false);
+#else
+	pthread_mutex_init(mutex, NULL);
+#endif
+}
+
+/**
+ * Releases a mutex initialized with initMutex.
+ */
+static void destroyMutex(ftgxMutex *mutex) {
+#ifdef GEKKO
+	LWP_MutexDestroy(*mutex);
+#else
+	pthread_mutex_destroy(mutex);
+#endif
+}
+
+/**
+ * Locks a mutex initialized with initMutex.
+ */
+static void lockMutex(ftgxMutex *mutex) {
+#ifdef GEKKO
+	LWP_MutexLock(*mutex);
+#else
+	pthread_mutex_lock(mutex);
+#endif
+}
+
+/**
+ * Unlocks a mutex locked with lockMutex.
+ */
+static void unlockMutex(ftgxMutex *mutex) {
+#ifdef GEKKO
+	LWP_MutexUnlock(*mutex);
+#else
+	pthread_mutex_unlock(mutex);
+#endif
+}
+
+/**
+ * Initializes a condition variable using the threading library of the target system.
+ */
+static void initCond(ftgxCond *cond) {
+#ifdef GEKKO
+	LWP_CondInit(cond);
+#else
+	pthread_cond_init(cond, NULL);
+#endif
+}
+
+/**
+ * Releases a condition variable initialized with initCond.
+ */
+static void destroyCond(ftgxCond *cond) {
+#ifdef GEKKO
+	LWP_CondDestroy(*cond);
+#else
+	pthread_cond_destroy(cond);
+#endif
+}
+
+/**
+ * Waits on a condition variable with the given mutex locked.
+ */
+static void waitCond(ftgxCond *cond, ftgxMutex *mutex) {
+#ifdef GEKKO
+	LWP_CondWait(*cond, *mutex);
+#else
+	pthread_cond_wait(cond, mutex);
+#endif
+}
+
+/**
+ * Wakes a thread waiting on a condition variable.
+ */
+static void signalCond(ftgxCond *cond) {
+#ifdef GEKKO
+	LWP_CondSignal(*cond);
+#else
+	pthread_cond_signal(cond);
+#endif
+}
+
+/**
+ * Gets a timestamp for measuring elapsed time with getElapsedMicroseconds.
+ */
+static uint64_t getTimestamp() {
+#ifdef GEKKO
+	return gettime();
+#else
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000 + now.tv_nsec / 1000;
+#endif
+}
+
+/**
+ * Gets the number of microseconds elapsed since a timestamp taken with getTimestamp.
+ */
+static uint32_t getElapsedMicroseconds(uint64_t since) {
+#ifdef GEKKO
+	return diff_usec(since, gettime());
+#else
+	return getTimestamp() - since;
+#endif
+}
+
+/**
+ * Gets the number of processors available to worker threads.
+ */
+static uint8_t getProcessorCount() {
+#ifdef GEKKO
+	return 1;
+#else
+	long processorCount = sysconf(_SC_NPROCESSORS_ONLN);
+	return processorCount < 1 ? 1 : processorCount > FTGX_RASTER_MAX_THREADS ? FTGX_RASTER_MAX_THREADS : processorCount;
+#endif
+}
+
 /**
  * Default constructor for the FreeTypeGX class.
  * 
@@ -29,8 +519,39 @@
  */ 
 FreeTypeGX::FreeTypeGX(uint8_t textureFormat, uint8_t vertexIndex) {
 	FT_Init_FreeType(&this->ftLibrary);
+	this->ftFace = NULL;
+	this->ftFontBuffer = NULL;
+	this->ftFontBufferSize = 0;
+	this->ftLoadedGlyph = FTGX_GLYPH_NONE;
+	this->ftKerningEnabled = false;
+	this->cacheThreadCount = 1;
+	this->fontSizeSerials = 0;
+	this->asyncCachingEnabled = false;
+	this->asyncThreadRunning = false;
+	this->asyncThreadStop = false;
+	this->asyncThreadFailed = false;
+	this->precacheIndex = 0;
+	initMutex(&this->asyncMutex);
+	initCond(&this->asyncCond);
+	this->fontSize = NULL;
+	this->fontSizeActivations = 0;
+	this->widthCachingEnabled = false;
+	this->clearTextWidthCache();
+	this->replacementCharacter = FTGX_REPLACEMENT_NOTDEF;
 
 	this->textureFormat = textureFormat;
+	this->gxTexCacheDirty = true;
+	this->compactVertices = false;
+	this->indexedTexCoords = false;
+	this->deferredRendering = false;
+	this->clipEnabled = false;
+	this->clipLeft = this->clipTop = this->clipRight = this->clipBottom = 0;
+	this->distanceFieldEnabled = false;
+	this->renderSize = 0;
+	this->renderScale = 1.0f;
+	this->subpixelPhases = 1;
+	guMtxIdentity(this->textViewMatrix);
+	this->resetState();
 	this->setVertexFormat(vertexIndex);
 	this->setCompatibilityMode(FTGX_COMPATIBILITY_NONE);
 }
@@ -41,6 +562,9 @@ FreeTypeGX::FreeTypeGX(uint8_t textureFormat, uint8_t vertexIndex) {
 FreeTypeGX::~FreeTypeGX() {
 	this->unloadFont();
 	FT_Done_FreeType(this->ftLibrary);
+
+	destroyCond(&this->asyncCond);
+	destroyMutex(&this->asyncMutex);
 }
 
 /**
@@ -53,9 +577,10 @@ FreeTypeGX::~FreeTypeGX() {
  * @return Wide character representation of supplied character string.
  */
 wchar_t* FreeTypeGX::charToWideChar(char* strChar) {
-	wchar_t *strWChar = new wchar_t[strlen(strChar) + 1];
+	size_t strLength = strlen(strChar);
+	wchar_t *strWChar = new wchar_t[strLength + 1];
 
-	int bt = mbstowcs(strWChar, strChar, strlen(strChar));
+	int bt = mbstowcs(strWChar, strChar, strLength);
 	if (bt) {
 		strWChar[bt] = (wchar_t)'\0';
 		return strWChar;
@@ -88,308 +613,3687 @@ void FreeTypeGX::setVertexFormat(uint8_t vertexIndex) {
 	this->vertexIndex = vertexIndex;
 	
 	GX_SetVtxAttrFmt(this->vertexIndex, GX_VA_POS, GX_POS_XY, GX_S16, 0);
-	GX_SetVtxAttrFmt(this->vertexIndex, GX_VA_TEX0, GX_TEX_ST, GX_F32, 0);
+	if(this->compactVertices) {
+		GX_SetVtxAttrFmt(this->vertexIndex, GX_VA_TEX0, GX_TEX_ST, GX_U16, FTGX_COMPACT_TEXCOORD_FRAC);
+	}
+	else {
+		GX_SetVtxAttrFmt(this->vertexIndex, GX_VA_TEX0, GX_TEX_ST, GX_F32, 0);
+	}
 	GX_SetVtxAttrFmt(this->vertexIndex, GX_VA_CLR0, GX_CLR_RGBA, GX_RGBA8, 0);
 }
 
 /**
- * Sets the TEV and VTX rendering compatibility requirements for the class.
+ * Enables or disables the compact vertex format for glyph quads.
  * 
- * This sets up the default TEV operation and VTX descriptions rendering values for the class. This ensures that FreeTypeGX
- * can remain compatible with external libraries or project code. Certain external libraries or code by design or lack of
- * foresight assume that the TEV operation and VTX descriptions values will remain constant or are always returned to a
- * certain value. This will enable compatibility with those libraries and any other code which cannot or will not be changed.
+ * The compact vertex format sends the texture coordinates of each glyph vertex as 16-bit fixed point values and omits
+ * the per vertex color, which is instead applied once per string through the TEV constant color register. This halves
+ * the FIFO traffic of each glyph from 64 to 32 bytes. The color vertex descriptor is disabled while glyphs are drawn and
+ * set to GX_DIRECT again at the end of the draw call.
  * 
- * @param compatibilityMode	Compatibility descriptor (FTGX_COMPATIBILITY_*) as defined in FreeTypeGX.h
-*/
-void FreeTypeGX::setCompatibilityMode(uint32_t compatibilityMode) {
-	this->compatibilityMode = compatibilityMode;
+ * @param enabled	The enabled state of the compact vertex format.
+ * @return The enabled state of the compact vertex format.
+ */
+bool FreeTypeGX::setCompactVerticesEnabled(bool enabled) {
+	this->compactVertices = enabled;
+	this->setVertexFormat(this->vertexIndex);
+
+	return this->compactVertices;
 }
 
 /**
- * Sets the maximum video width
- *
- * This routine optionally sets the maximum video pixel width of the screen in order to improve performance.
- *
- * @param width	The pixel width of the video screen.
- * @return The new size of the video screen in pixels.
+ * Gets the enabled state of the compact vertex format for glyph quads.
+ * 
+ * @return The enabled state of the compact vertex format.
  */
-uint16_t FreeTypeGX::maxVideoWidth = 0;
-uint16_t FreeTypeGX::setMaxVideoWidth(uint16_t width) {
-	return maxVideoWidth = width;
+bool FreeTypeGX::getCompactVerticesEnabled() {
+	return this->compactVertices;
 }
 
 /**
- * Sets the TEV operation and VTX descriptor values after texture rendering it complete.
+ * Enables or disables indexed texture coordinates for glyph quads.
  * 
- * This function calls the GX_SetTevOp and GX_SetVtxDesc functions with the compatibility parameters specified
- * in setCompatibilityMode.
+ * When enabled the four corner texture coordinates of each cached glyph are kept in a vertex array per point size and
+ * glyph vertices only send an 8-bit or 16-bit index into this array in place of their texture coordinates. The array is
+ * set with GX_SetArray for GX_VA_TEX0 whenever glyphs are drawn, so applications which draw with indexed texture
+ * coordinates themselves must set their own array again afterwards. Strings containing glyphs beyond the range of 16-bit
+ * indices are drawn with direct texture coordinates.
+ * 
+ * @param enabled	The enabled state of indexed texture coordinates.
+ * @return The enabled state of indexed texture coordinates.
  */
-void FreeTypeGX::setDefaultMode() {
-	if(this->compatibilityMode) {
-		switch(this->compatibilityMode & 0x00FF) {
-			case FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_MODULATE:
-				GX_SetTevOp(GX_TEVSTAGE0, GX_MODULATE);
-				break;
-			case FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_DECAL:
-				GX_SetTevOp(GX_TEVSTAGE0, GX_DECAL);
-				break;
-			case FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_BLEND:
-				GX_SetTevOp(GX_TEVSTAGE0, GX_BLEND);
-				break;
-			case FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_REPLACE:
-				GX_SetTevOp(GX_TEVSTAGE0, GX_REPLACE);
-				break;
-			case FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_PASSCLR:
-				GX_SetTevOp(GX_TEVSTAGE0, GX_PASSCLR);
-				break;
-			default:
-				break;
-		}
-		
-		switch(this->compatibilityMode & 0xFF00) {
-			case FTGX_COMPATIBILITY_DEFAULT_VTXDESC_GX_NONE:
-				GX_SetVtxDesc(GX_VA_TEX0, GX_NONE);
-				break;
-			case FTGX_COMPATIBILITY_DEFAULT_VTXDESC_GX_DIRECT:
-				GX_SetVtxDesc(GX_VA_TEX0, GX_DIRECT);
-				break;
-			case FTGX_COMPATIBILITY_DEFAULT_VTXDESC_GX_INDEX8:
-				GX_SetVtxDesc(GX_VA_TEX0, GX_INDEX8);
-				break;
-			case FTGX_COMPATIBILITY_DEFAULT_VTXDESC_GX_INDEX16:
-				GX_SetVtxDesc(GX_VA_TEX0, GX_INDEX16);
-				break;
-			default:
-				break;
-		}
-	}
+bool FreeTypeGX::setIndexedTexCoordsEnabled(bool enabled) {
+	return this->indexedTexCoords = enabled;
 }
 
 /**
- * Loads and processes a specified true type font buffer to a specific point size.
+ * Gets the enabled state of indexed texture coordinates for glyph quads.
  * 
- * This routine takes a precompiled true type font buffer and loads the necessary processed data into memory. This routine should be called before drawText will succeed. 
+ * @return The enabled state of indexed texture coordinates.
+ */
+bool FreeTypeGX::getIndexedTexCoordsEnabled() {
+	return this->indexedTexCoords;
+}
+
+/**
+ * Determines the texture coordinate vertex descriptor type with which to draw the pending glyph quads.
  * 
- * @param fontBuffer	A pointer in memory to a precompiled true type font buffer.
- * @param bufferSize	Size of the true type font buffer in bytes.
- * @param pointSize	The desired point size this wrapper's configured font face.
- * @param cacheAll	Optional flag to specify if all font characters should be cached when the class object is created. If specified as false the characters only become cached the first time they are used. If not specified default value is false.
+ * This routine selects GX_INDEX8 or GX_INDEX16 depending on the largest texture coordinate index of the pending glyph
+ * quads, creating or updating the texture coordinate array of the point size as required, or GX_DIRECT if indexed texture
+ * coordinates are disabled or cannot be used. As the FTGX_GLYPH_UNINDEXED index of quads trimmed by the clip rectangle or
+ * drawn at a subpixel phase exceeds the 16-bit index range, such pending quads always result in GX_DIRECT.
+ * 
+ * @param size	The point size whose glyphs are pending.
+ * @return The texture coordinate vertex descriptor type.
  */
-uint16_t FreeTypeGX::loadFont(uint8_t* fontBuffer, FT_Long bufferSize, FT_UInt pointSize, bool cacheAll) {
-	uint16_t numCached = 0;
+uint8_t FreeTypeGX::getTexCoordDesc(ftgxFontSize *size) {
+	if(!this->indexedTexCoords) {
+		return GX_DIRECT;
+	}
 
-	this->unloadFont();
-	this->ftFontBuffer = (FT_Byte *)fontBuffer;
-	this->ftFontBufferSize = bufferSize;
-	this->ftPointSize = pointSize;
+	uint16_t maxGlyphIndex = 0;
+	for(std::vector<ftgxGlyphQuad>::iterator i = this->glyphBatch.begin(); i != this->glyphBatch.end(); i++) {
+		if(i->glyphIndex > maxGlyphIndex) {
+			maxGlyphIndex = i->glyphIndex;
+		}
+	}
 
-	FT_New_Memory_Face(this->ftLibrary, this->ftFontBuffer, this->ftFontBufferSize, 0, &this->ftFace);
-	FT_Set_Pixel_Sizes(this->ftFace, 0, this->ftPointSize);
+	if(((uint32_t)maxGlyphIndex << 2) + 3 > 0xffff || !this->prepareTexCoordArray(size)) {
+		return GX_DIRECT;
+	}
+
+	return ((uint32_t)maxGlyphIndex << 2) + 3 > 0xff ? GX_INDEX16 : GX_INDEX8;
+}
+
+/**
+ * Creates or updates the texture coordinate array of a point size.
+ * 
+ * This routine creates the texture coordinate array of the point size if it does not yet exist, enlarges it if it cannot
+ * hold every glyph slot and rewrites it should its format not match the current vertex format. As the GPU may still be
+ * reading the array any replacement or rewrite is preceded by GX_DrawDone.
+ * 
+ * @param size	The point size.
+ * @return True if the texture coordinate array holds every glyph slot of the point size.
+ */
+bool FreeTypeGX::prepareTexCoordArray(ftgxFontSize *size) {
+	uint32_t glyphCount = size->glyphTextures.size();
+	uint8_t entrySize = this->compactVertices ? 4 * 2 * sizeof(uint16_t) : 4 * 2 * sizeof(f32);
+
+	if(size->texCoordArray != NULL && glyphCount <= size->texCoordCapacity && size->texCoordCompact == this->compactVertices) {
+		return true;
+	}
+
+	uint32_t capacity = size->texCoordCapacity > FTGX_TEXCOORD_ARRAY_MIN ? size->texCoordCapacity : FTGX_TEXCOORD_ARRAY_MIN;
+	while(capacity < glyphCount) {
+		capacity <<= 1;
+	}
+
+	void *texCoordArray = memalign(32, capacity * entrySize);
+	if(texCoordArray == NULL) {
+		return false;
+	}
+
+	if(size->texCoordArray != NULL) {
+		GX_DrawDone();
+		free(size->texCoordArray);
+	}
+
+	size->texCoordArray = texCoordArray;
+	size->texCoordCapacity = capacity;
+	size->texCoordCompact = this->compactVertices;
+
+	memset(texCoordArray, 0x00, capacity * entrySize);
+	for(uint32_t glyphIndex = 0; glyphIndex < glyphCount; glyphIndex++) {
+		this->storeTexCoords(size, glyphIndex);
+	}
+	DCFlushRange(texCoordArray, capacity * entrySize);
+
+	return true;
+}
+
+/**
+ * Writes the corner texture coordinates of a glyph into the texture coordinate array of its point size.
+ * 
+ * Glyphs beyond the capacity of the array are written once the array is enlarged by prepareTexCoordArray.
+ * 
+ * @param size	The point size.
+ * @param glyphIndex	The glyph slot less one.
+ */
+void FreeTypeGX::storeTexCoords(ftgxFontSize *size, uint16_t glyphIndex) {
+	if(glyphIndex >= size->texCoordCapacity) {
+		return;
+	}
+
+	ftgxCharTexture *charTexture = &size->glyphTextures[glyphIndex];
+	if(charTexture->texturePage >= FTGX_TEXTURE_QUEUED) {
+		return;
+	}
+
+	if(size->texCoordCompact) {
+		uint16_t *texCoords = (uint16_t *)size->texCoordArray + (glyphIndex << 3);
+		uint16_t textureCoordLeft = charTexture->textureCoordLeft * (1 << FTGX_COMPACT_TEXCOORD_FRAC);
+		uint16_t textureCoordTop = charTexture->textureCoordTop * (1 << FTGX_COMPACT_TEXCOORD_FRAC);
+		uint16_t textureCoordRight = charTexture->textureCoordRight * (1 << FTGX_COMPACT_TEXCOORD_FRAC);
+		uint16_t textureCoordBottom = charTexture->textureCoordBottom * (1 << FTGX_COMPACT_TEXCOORD_FRAC);
+
+		texCoords[0] = textureCoordLeft;	texCoords[1] = textureCoordTop;
+		texCoords[2] = textureCoordRight;	texCoords[3] = textureCoordTop;
+		texCoords[4] = textureCoordRight;	texCoords[5] = textureCoordBottom;
+		texCoords[6] = textureCoordLeft;	texCoords[7] = textureCoordBottom;
+		DCFlushRange(texCoords, 8 * sizeof(uint16_t));
+	}
+	else {
+		f32 *texCoords = (f32 *)size->texCoordArray + (glyphIndex << 3);
+
+		texCoords[0] = charTexture->textureCoordLeft;	texCoords[1] = charTexture->textureCoordTop;
+		texCoords[2] = charTexture->textureCoordRight;	texCoords[3] = charTexture->textureCoordTop;
+		texCoords[4] = charTexture->textureCoordRight;	texCoords[5] = charTexture->textureCoordBottom;
+		texCoords[6] = charTexture->textureCoordLeft;	texCoords[7] = charTexture->textureCoordBottom;
+		DCFlushRange(texCoords, 8 * sizeof(f32));
+	}
+}
+
+/**
+ * Sets the texture coordinate array indexed by glyph vertices.
+ * 
+ * @param texCoordArray	The texture coordinate array.
+ * @param compact	Flag indicating that the array holds 16-bit fixed point values.
+ */
+void FreeTypeGX::setTexCoordArray(void *texCoordArray, bool compact) {
+	GX_SetArray(GX_VA_TEX0, texCoordArray, compact ? 2 * sizeof(uint16_t) : 2 * sizeof(f32));
+}
+
+/**
+ * Sets the TEV and VTX rendering compatibility requirements for the class.
+ * 
+ * This sets up the default TEV operation and VTX descriptions rendering values for the class. This ensures that FreeTypeGX
+ * can remain compatible with external libraries or project code. Certain external libraries or code by design or lack of
+ * foresight assume that the TEV operation and VTX descriptions values will remain constant or are always returned to a
+ * certain value. This will enable compatibility with those libraries and any other code which cannot or will not be changed.
+ * 
+ * @param compatibilityMode	Compatibility descriptor (FTGX_COMPATIBILITY_*) as defined in FreeTypeGX.h
+*/
+void FreeTypeGX::setCompatibilityMode(uint32_t compatibilityMode) {
+	this->compatibilityMode = compatibilityMode;
+}
+
+/**
+ * Sets the number of worker threads used to cache the complete character set.
+ * 
+ * This routine sets the number of threads among which the rendering of glyphs is shared when all characters of a font are
+ * cached by loadFont. Each worker uses a font face of its own created from the shared font buffer and the rendered glyphs
+ * are packed into the texture atlas in character code order, so the resulting glyph caches are identical regardless of the
+ * number of threads. Specifying zero uses one thread per available processor. If not set a single thread is used.
+ * 
+ * @param threadCount	The number of worker threads, or zero for one per processor.
+ * @return The number of worker threads which will be used.
+ */
+uint8_t FreeTypeGX::setCacheThreadCount(uint8_t threadCount) {
+	this->cacheThreadCount = threadCount > FTGX_RASTER_MAX_THREADS ? FTGX_RASTER_MAX_THREADS : threadCount;
+	return this->getCacheThreadCount();
+}
+
+/**
+ * Gets the number of worker threads used to cache the complete character set.
+ * 
+ * @return The number of worker threads which will be used.
+ */
+uint8_t FreeTypeGX::getCacheThreadCount() {
+	return this->cacheThreadCount ? this->cacheThreadCount : getProcessorCount();
+}
+
+/**
+ * Sets the maximum video width
+ *
+ * This routine optionally sets the maximum video pixel width of the screen in order to improve performance.
+ *
+ * @param width	The pixel width of the video screen.
+ * @return The new size of the video screen in pixels.
+ */
+uint16_t FreeTypeGX::maxVideoWidth = 0;
+uint16_t FreeTypeGX::setMaxVideoWidth(uint16_t width) {
+	return maxVideoWidth = width;
+}
+
+/**
+ * Sets the TEV operation and VTX descriptor values after texture rendering it complete.
+ * 
+ * This function calls the GX_SetTevOp and GX_SetVtxDesc functions with the compatibility parameters specified
+ * in setCompatibilityMode. It is called once at the end of each draw call and only restores the state which was changed
+ * during the draw call.
+ */
+void FreeTypeGX::setDefaultMode() {
+	if(this->gxClrDesc != FTGX_GX_STATE_UNKNOWN) {
+		this->setClrDesc(GX_DIRECT);
+	}
+	if((this->gxTevOp == FTGX_TEVOP_KONST || this->gxTevOp == FTGX_TEVOP_DISTANCE_FIELD || this->gxTevOp == FTGX_TEVOP_DISTANCE_FIELD_KONST)
+		&& !(this->compatibilityMode & 0x00FF)) {
+		this->setTevOp(GX_MODULATE);
+	}
+
+	if(this->compatibilityMode && this->gxTevOp != FTGX_GX_STATE_UNKNOWN) {
+		switch(this->compatibilityMode & 0x00FF) {
+			case FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_MODULATE:
+				this->setTevOp(GX_MODULATE);
+				break;
+			case FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_DECAL:
+				this->setTevOp(GX_DECAL);
+				break;
+			case FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_BLEND:
+				this->setTevOp(GX_BLEND);
+				break;
+			case FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_REPLACE:
+				this->setTevOp(GX_REPLACE);
+				break;
+			case FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_PASSCLR:
+				this->setTevOp(GX_PASSCLR);
+				break;
+			default:
+				break;
+		}
+	}
+	if(this->compatibilityMode && this->gxTexDesc != FTGX_GX_STATE_UNKNOWN) {
+		switch(this->compatibilityMode & 0xFF00) {
+			case FTGX_COMPATIBILITY_DEFAULT_VTXDESC_GX_NONE:
+				this->setTexDesc(GX_NONE);
+				break;
+			case FTGX_COMPATIBILITY_DEFAULT_VTXDESC_GX_DIRECT:
+				this->setTexDesc(GX_DIRECT);
+				break;
+			case FTGX_COMPATIBILITY_DEFAULT_VTXDESC_GX_INDEX8:
+				this->setTexDesc(GX_INDEX8);
+				break;
+			case FTGX_COMPATIBILITY_DEFAULT_VTXDESC_GX_INDEX16:
+				this->setTexDesc(GX_INDEX16);
+				break;
+			default:
+				break;
+		}
+	}
+}
+
+/**
+ * Forgets the shadowed GX state at the start of a draw call.
+ * 
+ * As external code may change any GX state between draw calls the shadowed state is only valid within a single draw call.
+ */
+void FreeTypeGX::resetState() {
+	this->gxTevOp = FTGX_GX_STATE_UNKNOWN;
+	this->gxTexDesc = FTGX_GX_STATE_UNKNOWN;
+	this->gxClrDesc = FTGX_GX_STATE_UNKNOWN;
+	this->gxTexData = NULL;
+}
+
+/**
+ * Sets the TEV operation of stage 0 unless it is already set.
+ * 
+ * The distance field operations use a second TEV stage and the alpha compare unit, both of which are restored once any
+ * other operation is set.
+ * 
+ * @param tevOp	The TEV operation (GX_MODULATE, GX_PASSCLR, ...), FTGX_TEVOP_KONST to modulate the texture by the constant color register or FTGX_TEVOP_DISTANCE_FIELD and FTGX_TEVOP_DISTANCE_FIELD_KONST to threshold a distance field texture.
+ */
+void FreeTypeGX::setTevOp(uint8_t tevOp) {
+	if(this->gxTevOp == tevOp) {
+		return;
+	}
+
+	if(tevOp == FTGX_TEVOP_DISTANCE_FIELD || tevOp == FTGX_TEVOP_DISTANCE_FIELD_KONST) {
+		bool konst = tevOp == FTGX_TEVOP_DISTANCE_FIELD_KONST;
+
+		/* Stage 0 sharpens the distance (texture alpha - 3/8) * 4, placing the glyph edge at an alpha of one half */
+		GX_SetTevKAlphaSel(GX_TEVSTAGE0, GX_TEV_KASEL_3_8);
+		GX_SetTevColorIn(GX_TEVSTAGE0, GX_CC_ZERO, GX_CC_ZERO, GX_CC_ZERO, GX_CC_ZERO);
+		GX_SetTevAlphaIn(GX_TEVSTAGE0, GX_CA_KONST, GX_CA_ZERO, GX_CA_ZERO, GX_CA_TEXA);
+		GX_SetTevColorOp(GX_TEVSTAGE0, GX_TEV_ADD, GX_TB_ZERO, GX_CS_SCALE_1, GX_TRUE, GX_TEVPREV);
+		GX_SetTevAlphaOp(GX_TEVSTAGE0, GX_TEV_SUB, GX_TB_ZERO, GX_CS_SCALE_4, GX_TRUE, GX_TEVPREV);
+
+		/* Stage 1 applies the text color */
+		GX_SetTevOrder(GX_TEVSTAGE1, GX_TEXCOORDNULL, GX_TEXMAP_NULL, GX_COLOR0A0);
+		GX_SetTevKColorSel(GX_TEVSTAGE1, GX_TEV_KCSEL_K0);
+		GX_SetTevKAlphaSel(GX_TEVSTAGE1, GX_TEV_KASEL_K0_A);
+		GX_SetTevColorIn(GX_TEVSTAGE1, GX_CC_ZERO, GX_CC_ZERO, GX_CC_ZERO, konst ? GX_CC_KONST : GX_CC_RASC);
+		GX_SetTevAlphaIn(GX_TEVSTAGE1, GX_CA_ZERO, GX_CA_APREV, konst ? GX_CA_KONST : GX_CA_RASA, GX_CA_ZERO);
+		GX_SetTevColorOp(GX_TEVSTAGE1, GX_TEV_ADD, GX_TB_ZERO, GX_CS_SCALE_1, GX_TRUE, GX_TEVPREV);
+		GX_SetTevAlphaOp(GX_TEVSTAGE1, GX_TEV_ADD, GX_TB_ZERO, GX_CS_SCALE_1, GX_TRUE, GX_TEVPREV);
+
+		GX_SetNumTevStages(2);
+		GX_SetAlphaCompare(GX_GREATER, 0, GX_AOP_AND, GX_ALWAYS, 0);
+		this->gxTevOp = tevOp;
+		return;
+	}
+
+	if(this->gxTevOp == FTGX_TEVOP_DISTANCE_FIELD || this->gxTevOp == FTGX_TEVOP_DISTANCE_FIELD_KONST) {
+		GX_SetNumTevStages(1);
+		GX_SetAlphaCompare(GX_ALWAYS, 0, GX_AOP_AND, GX_ALWAYS, 0);
+	}
+
+	if(tevOp == FTGX_TEVOP_KONST) {
+		GX_SetTevKColorSel(GX_TEVSTAGE0, GX_TEV_KCSEL_K0);
+		GX_SetTevKAlphaSel(GX_TEVSTAGE0, GX_TEV_KASEL_K0_A);
+		GX_SetTevColorIn(GX_TEVSTAGE0, GX_CC_ZERO, GX_CC_TEXC, GX_CC_KONST, GX_CC_ZERO);
+		GX_SetTevAlphaIn(GX_TEVSTAGE0, GX_CA_ZERO, GX_CA_TEXA, GX_CA_KONST, GX_CA_ZERO);
+		GX_SetTevColorOp(GX_TEVSTAGE0, GX_TEV_ADD, GX_TB_ZERO, GX_CS_SCALE_1, GX_TRUE, GX_TEVPREV);
+		GX_SetTevAlphaOp(GX_TEVSTAGE0, GX_TEV_ADD, GX_TB_ZERO, GX_CS_SCALE_1, GX_TRUE, GX_TEVPREV);
+	}
+	else {
+		GX_SetTevOp(GX_TEVSTAGE0, tevOp);
+	}
+	this->gxTevOp = tevOp;
+}
+
+/**
+ * Sets the texture coordinate vertex descriptor unless it is already set.
+ * 
+ * @param texDesc	The vertex descriptor type (GX_NONE, GX_DIRECT, ...).
+ */
+void FreeTypeGX::setTexDesc(uint8_t texDesc) {
+	if(this->gxTexDesc != texDesc) {
+		GX_SetVtxDesc(GX_VA_TEX0, texDesc);
+		this->gxTexDesc = texDesc;
+	}
+}
+
+/**
+ * Sets the color vertex descriptor unless it is already set.
+ * 
+ * @param clrDesc	The vertex descriptor type (GX_NONE, GX_DIRECT, ...).
+ */
+void FreeTypeGX::setClrDesc(uint8_t clrDesc) {
+	if(this->gxClrDesc != clrDesc) {
+		GX_SetVtxDesc(GX_VA_CLR0, clrDesc);
+		this->gxClrDesc = clrDesc;
+	}
+}
+
+/**
+ * Sets the TEV constant color register used by the compact vertex format.
+ * 
+ * @param color	The color to apply to the glyphs.
+ */
+void FreeTypeGX::setKonstColor(GXColor color) {
+	GX_SetTevKColor(GX_KCOLOR0, color);
+}
+
+/**
+ * Loads an atlas page into texture map 0 unless it is already loaded.
+ * 
+ * The texture cache is only invalidated if the data of any atlas page has changed since it was last invalidated, leaving
+ * cached texels of other textures in the frame intact.
+ * 
+ * @param page	A pointer to the atlas page.
+ */
+void FreeTypeGX::loadTexturePage(ftgxTexturePage *page) {
+	if(this->gxTexCacheDirty) {
+		GX_InvalidateTexAll();
+		this->gxTexCacheDirty = false;
+	}
+
+	if(this->gxTexData != page->pageDataTexture) {
+		GX_LoadTexObj(&page->pageTexture, GX_TEXMAP0);
+		this->gxTexData = page->pageDataTexture;
+	}
+}
+
+/**
+ * Loads and processes a specified true type font buffer to a specific point size.
+ * 
+ * This routine takes a precompiled true type font buffer and loads the necessary processed data into memory. This routine should be called before drawText will succeed. 
+ * The font face and all glyph caches are always reloaded, even if the supplied buffer is the currently loaded font buffer, as its
+ * content may have changed. Use setSize to change only the point size of the loaded font.
+ * 
+ * @param fontBuffer	A pointer in memory to a precompiled true type font buffer.
+ * @param bufferSize	Size of the true type font buffer in bytes.
+ * @param pointSize	The desired point size this wrapper's configured font face.
+ * @param cacheAll	Optional flag to specify if all font characters should be cached when the class object is created. If specified as false the characters only become cached the first time they are used. If not specified default value is false.
+ */
+uint16_t FreeTypeGX::loadFont(uint8_t* fontBuffer, FT_Long bufferSize, FT_UInt pointSize, bool cacheAll) {
+	uint16_t numCached = 0;
+
+	this->unloadFont();
+	this->ftFontBuffer = (FT_Byte *)fontBuffer;
+	this->ftFontBufferSize = bufferSize;
+
+	if(FT_New_Memory_Face(this->ftLibrary, this->ftFontBuffer, this->ftFontBufferSize, 0, &this->ftFace)) {
+		this->ftFace = NULL;
+		return 0;
+	}
 
 	this->ftKerningEnabled = FT_HAS_KERNING(this->ftFace);
-	this->ftAscender = this->ftPointSize * this->ftFace->ascender / this->ftFace->units_per_EM;
-	this->ftDescender = this->ftPointSize * this->ftFace->descender / this->ftFace->units_per_EM;
 
-	if (cacheAll) {
-		numCached = this->cacheGlyphDataComplete();
+	if (this->setSize(pointSize) && cacheAll) {
+		numCached = this->cacheGlyphDataComplete();
+	}
+	
+	return numCached;
+}
+
+/**
+ * 
+ * \overload
+ */
+uint16_t FreeTypeGX::loadFont(const uint8_t* fontBuffer, FT_Long bufferSize, FT_UInt pointSize, bool cacheAll) {
+	return this->loadFont((uint8_t *)fontBuffer, bufferSize, pointSize, cacheAll);
+}
+
+/**
+ * Changes the point size of the loaded font.
+ * 
+ * This routine activates the glyph caches of the requested point size, creating them if the point size has not been used
+ * since the font was loaded. The glyph caches of up to FTGX_MAX_FONT_SIZES point sizes are retained so that switching between
+ * a small number of sizes neither reparses the font nor renders any glyph again. Once this limit is exceeded the caches of
+ * the least recently used point size are released. While distance field glyphs are enabled every point size shares the
+ * distance field glyph caches and only the scale applied to them changes.
+ * 
+ * @param pointSize	The desired point size this wrapper's configured font face.
+ * @return True if the point size was activated successfully.
+ */
+bool FreeTypeGX::setSize(FT_UInt pointSize) {
+	ftgxFontSize *size = NULL;
+	FT_UInt cacheSize = this->distanceFieldEnabled ? FTGX_DISTANCE_FIELD_SIZE : pointSize;
+	uint8_t phases = this->distanceFieldEnabled ? 1 : this->subpixelPhases;
+
+	if(pointSize == 0) {
+		return false;
+	}
+
+	for(std::vector<ftgxFontSize*>::iterator i = this->fontSizes.begin(); i != this->fontSizes.end(); i++) {
+		if((*i)->pointSize == cacheSize && ((*i)->texturePadding != 0) == this->distanceFieldEnabled
+			&& ((*i)->subpixelPhases == phases || (*i)->ftSize == NULL)) {
+			size = *i;
+			break;
+		}
+	}
+
+	if(size == NULL) {
+		if(this->ftFace == NULL) {
+			return false;
+		}
+
+		if(this->fontSizes.size() >= FTGX_MAX_FONT_SIZES) {
+			std::vector<ftgxFontSize*>::iterator leastUsed = this->fontSizes.begin();
+			for(std::vector<ftgxFontSize*>::iterator i = this->fontSizes.begin(); i != this->fontSizes.end(); i++) {
+				if((*i)->lastUsed < (*leastUsed)->lastUsed) {
+					leastUsed = i;
+				}
+			}
+
+			this->flush(true);
+			GX_DrawDone();
+			this->unloadFontSize(*leastUsed);
+			this->fontSizes.erase(leastUsed);
+		}
+
+		size = this->createFontSize(cacheSize);
+		if(size == NULL) {
+			return false;
+		}
+		this->fontSizes.push_back(size);
+	}
+
+	if(size != this->fontSize) {
+		if(size->ftSize != NULL) {
+			FT_Activate_Size(size->ftSize);
+		}
+		this->ftLoadedGlyph = FTGX_GLYPH_NONE;
+		this->fontSize = size;
+	}
+	size->lastUsed = ++this->fontSizeActivations;
+
+	this->renderSize = pointSize;
+	this->renderScale = (f32)pointSize / size->pointSize;
+
+	return true;
+}
+
+/**
+ * Gets the point size of the loaded font.
+ * 
+ * This routine gets the currently active point size of the loaded font.
+ * 
+ * @return The active point size, or zero if no font is loaded.
+ */
+FT_UInt FreeTypeGX::getSize() {
+	return this->fontSize != NULL ? this->renderSize : 0;
+}
+
+/**
+ * Creates the glyph caches of a point size.
+ * 
+ * This routine creates a new FreeType size object for the font face at the requested point size and initializes an empty
+ * set of glyph caches along with the kerning table for it. The new size object is left active.
+ * 
+ * @param pointSize	The desired point size this wrapper's configured font face.
+ * @return The new glyph caches, or NULL if the point size could not be created.
+ */
+ftgxFontSize* FreeTypeGX::createFontSize(FT_UInt pointSize) {
+	FT_Size ftSize;
+
+	if(FT_New_Size(this->ftFace, &ftSize)) {
+		return NULL;
+	}
+
+	FT_Activate_Size(ftSize);
+	if(FT_Set_Pixel_Sizes(this->ftFace, 0, pointSize)) {
+		FT_Done_Size(ftSize);
+		if(this->fontSize != NULL) {
+			FT_Activate_Size(this->fontSize->ftSize);
+		}
+		return NULL;
+	}
+	this->ftLoadedGlyph = FTGX_GLYPH_NONE;
+
+	ftgxFontSize *size = new ftgxFontSize();
+	size->ftSize = ftSize;
+	size->pointSize = pointSize;
+	size->ascender = pointSize * this->ftFace->ascender / this->ftFace->units_per_EM;
+	size->descender = pointSize * this->ftFace->descender / this->ftFace->units_per_EM;
+	size->extentTop = pointSize * this->ftFace->bbox.yMax / this->ftFace->units_per_EM + 1;
+	size->extentBottom = -pointSize * this->ftFace->bbox.yMin / this->ftFace->units_per_EM + 1;
+	size->texturePadding = this->distanceFieldEnabled ? FTGX_DISTANCE_FIELD_SPREAD : 0;
+	size->subpixelPhases = this->distanceFieldEnabled ? 1 : this->subpixelPhases;
+	size->phaseTextureSize = 0;
+	size->lastUsed = 0;
+	size->sizeSerial = ++this->fontSizeSerials;
+	memset(&size->glyphTable, 0x00, sizeof(ftgxGlyphTable));
+	size->replacementSlot = 0;
+	size->notdefSlot = 0;
+	size->solidSlot = 0;
+	size->numberSlotsResolved = false;
+	size->texCoordArray = NULL;
+	size->texCoordCapacity = 0;
+	size->texCoordCompact = false;
+
+	this->fontSize = size;
+	this->loadKerningTable();
+
+	return size;
+}
+
+/**
+ * Clears the glyph caches of a point size.
+ * 
+ * This routine frees all texture atlas pages and glyph data of the point size along with its FreeType size object.
+ * Note that the caller must ensure the GX pipeline is no longer reading from the texture atlas pages.
+ * 
+ * @param size	The glyph caches to clear.
+ */
+void FreeTypeGX::unloadFontSize(ftgxFontSize *size) {
+	for( std::vector<ftgxTexturePage>::iterator i = size->texturePages.begin(); i != size->texturePages.end(); i++) {
+		if(i->pageDataOwned) {
+			free(i->pageDataTexture);
+		}
+	}
+	this->clearGlyphTable(&size->glyphTable);
+	free(size->texCoordArray);
+
+	if(this->fontSize == size) {
+		this->fontSize = NULL;
+	}
+	if(size->ftSize != NULL) {
+		FT_Done_Size(size->ftSize);
+	}
+
+	delete size;
+}
+
+/**
+ * Determines whether kerning data is available for the loaded font.
+ * 
+ * @return True if the font face reports kerning data or the active point size holds a non-empty kerning table.
+ */
+bool FreeTypeGX::hasKerning() {
+	if(this->ftFace != NULL) {
+		return FT_HAS_KERNING(this->ftFace);
+	}
+
+	return this->fontSize != NULL && this->fontSize->kerningTableLoaded && !this->fontSize->kerningPairs.empty();
+}
+
+/**
+ * Loads a prebuilt font cache buffer.
+ * 
+ * This routine loads the glyph caches of a single point size from a buffer previously created by saveFontCache, replacing any
+ * loaded font. No FreeType parsing or rasterization takes place and the page textures are used in place whenever the buffer
+ * is 32 byte aligned, as is the case for buffers compiled into the executable with bin2o. Characters not held within the
+ * buffer are treated as unsupported by the font. The buffer must have been created with the texture format and distance field
+ * mode of this instance and must remain valid until the font is unloaded. The buffer is validated completely before the
+ * loaded font is replaced, so that the loaded font is retained should the buffer be rejected or its pages not be allocated.
+ * The kerning mode is not changed and the kerning pairs of the buffer are applied only while kerning is enabled with
+ * setKerningEnabled. Buffers saved before the kerning table of their point size was loaded carry no kerning.
+ * 
+ * @param cacheBuffer	A pointer in memory to a prebuilt font cache buffer.
+ * @param bufferSize	Size of the font cache buffer in bytes.
+ * @return True if the font cache buffer was loaded successfully.
+ */
+bool FreeTypeGX::loadFontCache(uint8_t* cacheBuffer, uint32_t bufferSize) {
+	ftgxCacheHeader header;
+
+	if(bufferSize < FTGX_CACHE_HEADER_SIZE) {
+		return false;
+	}
+
+	readCacheHeader(cacheBuffer, &header);
+	if(header.cacheMagic != FTGX_CACHE_MAGIC || header.cacheVersion != FTGX_CACHE_VERSION || header.textureFormat != this->textureFormat
+		|| (header.texturePadding != 0) != this->distanceFieldEnabled || header.pointSize == 0) {
+		return false;
+	}
+	if(header.glyphCount >= FTGX_GLYPH_MISSING || header.notdefSlot > header.glyphCount || header.solidSlot > header.glyphCount) {
+		return false;
+	}
+	if(header.kerningCount != 0 && !(header.cacheFlags & FTGX_CACHE_KERNING)) {
+		return false;
+	}
+
+	/* Record offsets are calculated in 64 bits so that corrupt counts cannot wrap around */
+	uint64_t glyphOffset = FTGX_CACHE_HEADER_SIZE + (uint64_t)header.charCount * FTGX_CACHE_CHAR_SIZE;
+	uint64_t pageOffset = glyphOffset + (uint64_t)header.glyphCount * FTGX_CACHE_GLYPH_SIZE;
+	uint64_t kerningOffset = pageOffset + (uint64_t)header.pageCount * FTGX_CACHE_PAGE_SIZE;
+
+	if(kerningOffset + (uint64_t)header.kerningCount * FTGX_CACHE_KERNING_SIZE > bufferSize) {
+		return false;
+	}
+
+	FT_Byte *chars = cacheBuffer + FTGX_CACHE_HEADER_SIZE;
+	FT_Byte *glyphs = cacheBuffer + glyphOffset;
+	FT_Byte *pages = cacheBuffer + pageOffset;
+	FT_Byte *kerningPairs = cacheBuffer + kerningOffset;
+
+	for(uint32_t charIndex = 0; charIndex < header.charCount; charIndex++) {
+		uint16_t glyphSlot = readTableUInt16(chars + charIndex * FTGX_CACHE_CHAR_SIZE + 4);
+
+		if(glyphSlot == 0 || (glyphSlot != FTGX_GLYPH_MISSING && glyphSlot > header.glyphCount)) {
+			return false;
+		}
+	}
+
+	for(uint16_t pageIndex = 0; pageIndex < header.pageCount; pageIndex++) {
+		FT_Byte *page = pages + pageIndex * FTGX_CACHE_PAGE_SIZE;
+		uint16_t pageWidth = readTableUInt16(page), pageHeight = readTableUInt16(page + 2);
+
+		if(pageWidth == 0 || pageHeight == 0 || pageWidth > FTGX_CACHE_PAGE_MAX || pageHeight > FTGX_CACHE_PAGE_MAX
+			|| (uint64_t)readTableUInt32(page + 4) + getTextureSize(pageWidth, pageHeight, header.textureFormat) > bufferSize) {
+			return false;
+		}
+	}
+
+	std::vector<ftgxCharData> metrics(header.glyphCount);
+	std::vector<ftgxCharTexture> textures(header.glyphCount);
+
+	for(uint16_t glyphSlot = 0; glyphSlot < header.glyphCount; glyphSlot++) {
+		ftgxCharTexture *charTexture = &textures[glyphSlot];
+
+		readCacheGlyph(glyphs + glyphSlot * FTGX_CACHE_GLYPH_SIZE, &metrics[glyphSlot], charTexture);
+		if(charTexture->texturePage == FTGX_TEXTURE_PENDING || charTexture->texturePage == FTGX_TEXTURE_QUEUED
+			|| (charTexture->textureWidth && charTexture->textureHeight && charTexture->texturePage >= header.pageCount)) {
+			return false;
+		}
+	}
+
+	/* Pages are prepared before the loaded font is replaced so that a failed allocation leaves it intact */
+	std::vector<ftgxTexturePage> texturePages(header.pageCount);
+	for(uint16_t pageIndex = 0; pageIndex < header.pageCount; pageIndex++) {
+		FT_Byte *pageRecord = pages + pageIndex * FTGX_CACHE_PAGE_SIZE;
+		FT_Byte *pageData = cacheBuffer + readTableUInt32(pageRecord + 4);
+		ftgxTexturePage *page = &texturePages[pageIndex];
+
+		page->pageWidth = readTableUInt16(pageRecord);
+		page->pageHeight = readTableUInt16(pageRecord + 2);
+		page->pageUsed = page->pageHeight;
+		page->pageDataOwned = ((uintptr_t)pageData & 31) != 0;
+
+		uint32_t pageSize = getTextureSize(page->pageWidth, page->pageHeight, header.textureFormat);
+		if(page->pageDataOwned) {
+			page->pageDataTexture = (uint32_t *)memalign(32, pageSize);
+			if(page->pageDataTexture == NULL) {
+				for(uint16_t ownedIndex = 0; ownedIndex < pageIndex; ownedIndex++) {
+					if(texturePages[ownedIndex].pageDataOwned) {
+						free(texturePages[ownedIndex].pageDataTexture);
+					}
+				}
+				return false;
+			}
+			memcpy(page->pageDataTexture, pageData, pageSize);
+		}
+		else {
+			page->pageDataTexture = (uint32_t *)pageData;
+		}
+		DCFlushRange(page->pageDataTexture, pageSize);
+
+		GX_InitTexObj(&page->pageTexture, page->pageDataTexture, page->pageWidth, page->pageHeight, header.textureFormat, GX_CLAMP, GX_CLAMP, GX_FALSE);
+	}
+
+	this->unloadFont();
+	this->gxTexCacheDirty = true;
+
+	ftgxFontSize *size = new ftgxFontSize();
+	size->ftSize = NULL;
+	size->pointSize = header.pointSize;
+	size->ascender = header.ascender;
+	size->descender = header.descender;
+	size->extentTop = header.ascender;
+	size->extentBottom = -header.descender;
+	size->texturePadding = header.texturePadding;
+	size->subpixelPhases = 1;
+	size->phaseTextureSize = 0;
+	size->lastUsed = 0;
+	size->sizeSerial = ++this->fontSizeSerials;
+	memset(&size->glyphTable, 0x00, sizeof(ftgxGlyphTable));
+	size->replacementSlot = 0;
+	size->notdefSlot = header.notdefSlot;
+	size->solidSlot = header.solidSlot;
+	size->numberSlotsResolved = false;
+	size->texCoordArray = NULL;
+	size->texCoordCapacity = 0;
+	size->texCoordCompact = false;
+	size->glyphMetrics.swap(metrics);
+	size->glyphTextures.swap(textures);
+	size->texturePages.swap(texturePages);
+	size->kerningTableLoaded = (header.cacheFlags & FTGX_CACHE_KERNING) != 0;
+
+	for(uint32_t pairIndex = 0; pairIndex < header.kerningCount; pairIndex++) {
+		FT_Byte *pair = kerningPairs + pairIndex * FTGX_CACHE_KERNING_SIZE;
+		size->kerningPairs.push_back((ftgxKerningPair){ readTableUInt32(pair), (int16_t)readTableUInt16(pair + 4) });
+	}
+
+	for(uint16_t glyphSlot = 0; glyphSlot < header.glyphCount; glyphSlot++) {
+		if(glyphSlot + 1 == header.solidSlot) {
+			continue;
+		}
+
+		int16_t glyphTop = (int16_t)size->glyphMetrics[glyphSlot].renderOffsetY;
+		int16_t glyphBottom = size->glyphTextures[glyphSlot].textureHeight - glyphTop;
+
+		size->extentTop = std::max<int16_t>(size->extentTop, glyphTop);
+		size->extentBottom = std::max<int16_t>(size->extentBottom, glyphBottom);
+	}
+
+	this->fontSizes.push_back(size);
+	this->fontSize = size;
+	this->fontSize->lastUsed = ++this->fontSizeActivations;
+	this->renderSize = size->pointSize;
+	this->renderScale = 1.0f;
+
+	for(uint32_t charIndex = 0; charIndex < header.charCount; charIndex++) {
+		FT_Byte *charRecord = chars + charIndex * FTGX_CACHE_CHAR_SIZE;
+		uint16_t *glyphSlot = this->allocateGlyphSlot(readTableUInt32(charRecord));
+
+		if(glyphSlot != NULL) {
+			*glyphSlot = readTableUInt16(charRecord + 4);
+		}
+	}
+
+	return true;
+}
+
+/**
+ * 
+ * \overload
+ */
+bool FreeTypeGX::loadFontCache(const uint8_t* cacheBuffer, uint32_t bufferSize) {
+	return this->loadFontCache((uint8_t *)cacheBuffer, bufferSize);
+}
+
+/**
+ * Saves the glyph caches of the active point size into a prebuilt font cache buffer.
+ * 
+ * This routine renders the texture of every cached glyph which has not yet been drawn and serializes the glyph caches,
+ * kerning table and texture atlas pages of the active point size into the supplied buffer so that it may later be loaded
+ * with loadFontCache. Typically the font is first loaded with all characters cached, the required buffer size is queried by
+ * passing a NULL buffer and the saved buffer is written to a file for inclusion in the final executable. As loaded caches
+ * position glyphs on whole pixels the kerning adjustments of a point size with subpixel phases are saved rounded to whole
+ * pixels, and no kerning is saved unless the kerning table of the point size was loaded.
+ * 
+ * @param cacheBuffer	A 32 byte aligned pointer in memory to the buffer to fill, or NULL to only calculate the required size.
+ * @param bufferSize	Size of the supplied buffer in bytes.
+ * @return The size of the font cache buffer in bytes. Nothing is written if this exceeds bufferSize.
+ */
+uint32_t FreeTypeGX::saveFontCache(uint8_t* cacheBuffer, uint32_t bufferSize) {
+	if(this->fontSize == NULL) {
+		return 0;
+	}
+
+	for(uint16_t glyphSlot = 0; glyphSlot < this->fontSize->glyphMetrics.size(); glyphSlot++) {
+		ftgxCharTexture *charTexture = &this->fontSize->glyphTextures[glyphSlot];
+		if(charTexture->texturePage == FTGX_TEXTURE_PENDING || charTexture->texturePage == FTGX_TEXTURE_QUEUED) {
+			this->cacheGlyphTexture(&this->fontSize->glyphMetrics[glyphSlot], charTexture);
+		}
+	}
+	this->getSolidSlot();
+
+	uint32_t charCount = 0;
+	for(uint32_t charCode = 0; charCode < 0x10000 * (FTGX_GLYPH_PLANES + 1); charCode++) {
+		if(this->findGlyphSlot(charCode)) {
+			charCount++;
+		}
+	}
+
+	uint16_t glyphCount = this->fontSize->glyphMetrics.size();
+	uint16_t pageCount = this->fontSize->texturePages.size();
+
+	/* Loaded caches position glyphs on whole pixels, so subpixel kerning is rounded as loadKerningTable would */
+	std::vector<ftgxKerningPair> kerningPairs;
+	if(this->fontSize->kerningTableLoaded) {
+		for(std::vector<ftgxKerningPair>::iterator i = this->fontSize->kerningPairs.begin(); i != this->fontSize->kerningPairs.end(); i++) {
+			int16_t kerningX = this->fontSize->subpixelPhases > 1 ? clampKerning((i->kerningX + 32) & -64) : i->kerningX;
+			if(kerningX != 0) {
+				kerningPairs.push_back((ftgxKerningPair){ i->glyphPair, kerningX });
+			}
+		}
+	}
+	uint32_t kerningCount = kerningPairs.size();
+
+	uint32_t cacheSize = FTGX_CACHE_HEADER_SIZE + charCount * FTGX_CACHE_CHAR_SIZE + glyphCount * FTGX_CACHE_GLYPH_SIZE
+		+ pageCount * FTGX_CACHE_PAGE_SIZE + kerningCount * FTGX_CACHE_KERNING_SIZE;
+	uint32_t pageOffset = (cacheSize + 31) & ~31;
+
+	cacheSize = pageOffset;
+	for(std::vector<ftgxTexturePage>::iterator i = this->fontSize->texturePages.begin(); i != this->fontSize->texturePages.end(); i++) {
+		cacheSize += (getTextureSize(i->pageWidth, i->pageHeight, this->textureFormat) + 31) & ~31;
+	}
+
+	if(cacheBuffer == NULL || cacheSize > bufferSize) {
+		return cacheSize;
+	}
+
+	memset(cacheBuffer, 0x00, cacheSize);
+
+	ftgxCacheHeader header;
+	header.cacheMagic = FTGX_CACHE_MAGIC;
+	header.cacheVersion = FTGX_CACHE_VERSION;
+	header.textureFormat = this->textureFormat;
+	header.pointSize = this->fontSize->pointSize;
+	header.ascender = this->fontSize->ascender;
+	header.descender = this->fontSize->descender;
+	header.notdefSlot = this->fontSize->notdefSlot;
+	header.glyphCount = glyphCount;
+	header.pageCount = pageCount;
+	header.texturePadding = this->fontSize->texturePadding;
+	header.solidSlot = this->fontSize->solidSlot;
+	header.charCount = charCount;
+	header.kerningCount = kerningCount;
+	header.cacheFlags = this->fontSize->kerningTableLoaded ? FTGX_CACHE_KERNING : 0;
+	writeCacheHeader(cacheBuffer, &header);
+
+	FT_Byte *record = cacheBuffer + FTGX_CACHE_HEADER_SIZE;
+	for(uint32_t charCode = 0; charCode < 0x10000 * (FTGX_GLYPH_PLANES + 1); charCode++) {
+		uint16_t glyphSlot = this->findGlyphSlot(charCode);
+		if(glyphSlot) {
+			writeTableUInt32(record, charCode);
+			writeTableUInt16(record + 4, glyphSlot);
+			record += FTGX_CACHE_CHAR_SIZE;
+		}
+	}
+
+	for(uint16_t glyphSlot = 0; glyphSlot < glyphCount; glyphSlot++) {
+		writeCacheGlyph(record, &this->fontSize->glyphMetrics[glyphSlot], &this->fontSize->glyphTextures[glyphSlot]);
+		record += FTGX_CACHE_GLYPH_SIZE;
+	}
+
+	for(std::vector<ftgxTexturePage>::iterator i = this->fontSize->texturePages.begin(); i != this->fontSize->texturePages.end(); i++) {
+		uint32_t pageSize = getTextureSize(i->pageWidth, i->pageHeight, this->textureFormat);
+
+		writeTableUInt16(record, i->pageWidth);
+		writeTableUInt16(record + 2, i->pageHeight);
+		writeTableUInt32(record + 4, pageOffset);
+		record += FTGX_CACHE_PAGE_SIZE;
+
+		memcpy(cacheBuffer + pageOffset, i->pageDataTexture, pageSize);
+		pageOffset += (pageSize + 31) & ~31;
+	}
+
+	for(uint32_t pairIndex = 0; pairIndex < kerningCount; pairIndex++) {
+		writeTableUInt32(record, kerningPairs[pairIndex].glyphPair);
+		writeTableUInt16(record + 4, (uint16_t)kerningPairs[pairIndex].kerningX);
+		record += FTGX_CACHE_KERNING_SIZE;
+	}
+
+	return cacheSize;
+}
+
+/**
+ * Clears all loaded font glyph data.
+ * 
+ * This routine clears the glyph caches of every point size and frees all allocated memory back to the system.
+ */
+void FreeTypeGX::unloadFont() {
+	this->stopAsyncCaching();
+	this->flush(true);
+
+	GX_DrawDone();
+	GX_Flush();
+	
+	for( std::vector<ftgxFontSize*>::iterator i = this->fontSizes.begin(); i != this->fontSizes.end(); i++) {
+		this->unloadFontSize(*i);
+	}
+	this->fontSizes.clear();
+	this->fontSize = NULL;
+
+	if(this->ftFace) {
+		FT_Done_Face(this->ftFace);
+		this->ftFace = NULL;
+	}
+	this->ftLoadedGlyph = FTGX_GLYPH_NONE;
+
+	this->precacheChars.clear();
+	this->precacheIndex = 0;
+
+	this->clearTextWidthCache();
+}
+
+/**
+ * Loads the kerning data of the font into the kerning table.
+ *
+ * This routine reads every horizontal pair adjustment of the TrueType kern table of the font, scales each adjustment to
+ * pixels at the current point size exactly as FT_Get_Kerning would and stores the non-zero adjustments sorted by glyph
+ * pair so that kerning lookups never need to query the font face. Fonts whose kerning data is not held within a
+ * TrueType kern table continue to be kerned through FT_Get_Kerning.
+ */
+void FreeTypeGX::loadKerningTable() {
+	FT_ULong tableSize = 0;
+
+	this->fontSize->kerningPairs.clear();
+	this->fontSize->kerningTableLoaded = false;
+
+	if(!FT_HAS_KERNING(this->ftFace) || !FT_IS_SFNT(this->ftFace)) {
+		return;
+	}
+	if(FT_Load_Sfnt_Table(this->ftFace, TTAG_kern, 0, NULL, &tableSize) || tableSize < 4) {
+		return;
+	}
+
+	FT_Byte *table = (FT_Byte *)malloc(tableSize);
+	if(FT_Load_Sfnt_Table(this->ftFace, TTAG_kern, 0, table, &tableSize) || readTableUInt16(table) != 0) {
+		free(table);
+		return;
+	}
+
+	FT_Fixed scaleX = this->ftFace->size->metrics.x_scale;
+	FT_UShort pixelsX = this->ftFace->size->metrics.x_ppem;
+
+	FT_Byte *subtable = table + 4, *tableEnd = table + tableSize;
+	for(uint16_t subtableCount = readTableUInt16(table + 2); subtableCount > 0 && subtable + 14 <= tableEnd; subtableCount--) {
+		uint16_t subtableLength = readTableUInt16(subtable + 2);
+		uint16_t coverage = readTableUInt16(subtable + 4);
+
+		if(subtableLength < 14) {
+			break;
+		}
+
+		/* Horizontal format 0 subtables which are neither minimum values nor cross-stream */
+		if((coverage & 0xff07) == 0x0001) {
+			FT_Byte *pair = subtable + 14;
+
+			for(uint16_t pairCount = readTableUInt16(subtable + 6); pairCount > 0 && pair + 6 <= tableEnd; pairCount--, pair += 6) {
+				FT_Pos kerningX = FT_MulFix((int16_t)readTableUInt16(pair + 4), scaleX);
+				if(pixelsX < 25) {
+					kerningX = FT_MulDiv(kerningX, pixelsX, 25);
+				}
+				if(this->fontSize->subpixelPhases == 1) {
+					kerningX = (kerningX + 32) & -64;
+				}
+
+				if(kerningX != 0) {
+					this->fontSize->kerningPairs.push_back((ftgxKerningPair){ ((uint32_t)readTableUInt16(pair) << 16) | readTableUInt16(pair + 2), clampKerning(kerningX) });
+				}
+			}
+		}
+
+		subtable += subtableLength;
+	}
+	free(table);
+
+	/* Combine the adjustments of pairs which appear within several subtables */
+	std::stable_sort(this->fontSize->kerningPairs.begin(), this->fontSize->kerningPairs.end(), compareKerningPair);
+
+	std::vector<ftgxKerningPair>::iterator last = this->fontSize->kerningPairs.begin();
+	for(std::vector<ftgxKerningPair>::iterator i = this->fontSize->kerningPairs.begin(); i != this->fontSize->kerningPairs.end(); i++) {
+		if(i == last) {
+			continue;
+		}
+		if(i->glyphPair == last->glyphPair) {
+			last->kerningX = clampKerning((FT_Pos)last->kerningX + i->kerningX);
+		}
+		else {
+			*++last = *i;
+		}
+	}
+	if(!this->fontSize->kerningPairs.empty()) {
+		this->fontSize->kerningPairs.erase(last + 1, this->fontSize->kerningPairs.end());
+	}
+
+	this->fontSize->kerningTableLoaded = true;
+}
+
+/**
+ * Returns the horizontal kerning adjustment of a pair of glyphs.
+ *
+ * This routine looks up the kerning adjustment of the supplied glyph pair within the kerning table, or queries the font
+ * face if its kerning data could not be loaded into the kerning table.
+ *
+ * @param leftIndex	Index of the left glyph of the pair within the font face.
+ * @param rightIndex	Index of the right glyph of the pair within the font face.
+ * @return The kerning adjustment in 26.6 fixed point pixels, rounded to whole pixels unless glyphs are positioned at subpixel phases.
+ */
+int16_t FreeTypeGX::getKerning(FT_UInt leftIndex, FT_UInt rightIndex) {
+	if(!this->fontSize->kerningTableLoaded) {
+		if(this->ftFace == NULL) {
+			return 0;
+		}
+
+		FT_Vector pairDelta;
+		FT_Get_Kerning( this->ftFace, leftIndex, rightIndex, this->fontSize->subpixelPhases > 1 ? FT_KERNING_UNFITTED : FT_KERNING_DEFAULT, &pairDelta );
+		return pairDelta.x;
+	}
+
+	ftgxKerningPair key = { (leftIndex << 16) | rightIndex, 0 };
+	std::vector<ftgxKerningPair>::iterator pair = std::lower_bound(this->fontSize->kerningPairs.begin(), this->fontSize->kerningPairs.end(), key, compareKerningPair);
+
+	return pair != this->fontSize->kerningPairs.end() && pair->glyphPair == key.glyphPair ? pair->kerningX : 0;
+}
+
+/**
+ * Enables or disables kerning of the output text.
+ *
+ * This routine enables or disables kerning of the output text only if kerning is supported by the font.
+ * Note that by default kerning is enabled if it is supported by the font.
+ *
+ * @param enabled	The enabled state of the font kerning.
+ * @return The resultant enabled state of the font kerning.
+ */
+bool FreeTypeGX::setKerningEnabled(bool enabled) {
+	bool kerningEnabled = enabled && this->hasKerning();
+
+	if(kerningEnabled != this->ftKerningEnabled) {
+		this->clearTextWidthCache();
+	}
+
+	return this->ftKerningEnabled = kerningEnabled;
+}
+
+/**
+ * Gets the current enabled state of the font kerning mode.
+ *
+ * This routine gets the current enabled state of the font kerning mode.
+ *
+ * @return The enabled state of the font kerning.
+ */
+bool FreeTypeGX::getKerningEnabled() {
+	return this->ftKerningEnabled;
+}
+
+/**
+ * Enables or disables width value caching of the output text.
+ *
+ * This routine enables or disables width value caching of the output text in order avoid a repeated possible calculation of
+ * textual width within the drawText function. If enabled FreeTypeGX will cache the widths of the most recently drawn text
+ * strings. Strings are identified by their content rather than their address so that temporary and reused buffers are
+ * handled correctly. Once FTGX_WIDTH_CACHE_SIZE strings have been cached the least recently used width is replaced. Strings
+ * longer than FTGX_WIDTH_CACHE_TEXT_LENGTH characters are always measured. The cache is cleared automatically whenever the font or kerning mode changes. Font width caching may be enabled or disabled at
+ * any time by calling this function. Note that by default this option is disabled.
+ *
+ * @param enabled	The desired enabled state of the text width caching.
+ * @return The resultant enabled state of the text width caching.
+ */
+bool FreeTypeGX::setTextWidthCachingEnabled(bool enabled) {
+	return this->widthCachingEnabled = enabled;
+}
+
+/**
+ * Gets the current enabled state of the text width caching mode.
+ *
+ * This routine gets the current enabled state of the text width caching mode.
+ *
+ * @return The enabled state of the text width caching.
+ */
+bool FreeTypeGX::getTextWidthCachingEnabled() {
+	return this->widthCachingEnabled;
+}
+
+/**
+ * Clears the current cache of text widths.
+ *
+ * This clears the cache of text widths regardless of the enabled state of the width caching flag.
+ */
+void FreeTypeGX::clearTextWidthCache() {
+	memset(this->widthCacheBuckets, 0xff, sizeof(this->widthCacheBuckets));
+	this->widthCacheCount = 0;
+	this->widthCacheFirst = FTGX_WIDTH_CACHE_NONE;
+	this->widthCacheLast = FTGX_WIDTH_CACHE_NONE;
+}
+
+/**
+ * Hashes the content of a text string.
+ *
+ * This routine calculates the 32-bit FNV-1a hash of the characters of the supplied string along with its length.
+ *
+ * @param text	NULL terminated string to hash.
+ * @param length	Output number of characters in the string.
+ * @return The hash of the string.
+ */
+uint32_t FreeTypeGX::hashText(wchar_t *text, uint32_t *length) {
+	uint32_t hash = 2166136261U;
+	uint32_t i = 0;
+
+	while(text[i]) {
+		hash = (hash ^ (uint32_t)text[i]) * 16777619U;
+		i++;
+	}
+
+	*length = i;
+	return hash;
+}
+
+/**
+ * Returns the width of the string in pixels making use of the text width cache.
+ *
+ * This routine locates the width of the supplied string within the text width cache, calculating and caching it if it is
+ * not found. Entries are matched by comparing their characters with the string, so that strings whose hashes collide are
+ * never confused. Widths are cached separately for each point size. If text width caching is disabled or the string is
+ * longer than FTGX_WIDTH_CACHE_TEXT_LENGTH characters the width is always calculated.
+ *
+ * @param text	NULL terminated string to calculate.
+ * @return The width of the text string in pixels.
+ */
+uint16_t FreeTypeGX::getCachedWidth(wchar_t *text) {
+	if(!this->widthCachingEnabled) {
+		return this->getWidth(text);
+	}
+
+	uint32_t textLength;
+	uint32_t textHash = hashText(text, &textLength);
+	if(textLength > FTGX_WIDTH_CACHE_TEXT_LENGTH) {
+		return this->getWidth(text);
+	}
+
+	uint16_t *bucket = &this->widthCacheBuckets[textHash & (FTGX_WIDTH_CACHE_BUCKETS - 1)];
+	uint16_t entryIndex;
+	ftgxWidthCacheEntry *entry;
+
+	for(entryIndex = *bucket; entryIndex != FTGX_WIDTH_CACHE_NONE; entryIndex = entry->hashNext) {
+		entry = &this->widthCache[entryIndex];
+		if(entry->textHash == textHash && entry->textLength == textLength && entry->textSize == this->renderSize && memcmp(entry->text, text, textLength * sizeof(wchar_t)) == 0) {
+			break;
+		}
+	}
+
+	if(entryIndex == FTGX_WIDTH_CACHE_NONE) {
+		if(this->widthCacheCount < FTGX_WIDTH_CACHE_SIZE) {
+			entryIndex = this->widthCacheCount++;
+			entry = &this->widthCache[entryIndex];
+		}
+		else {
+			/* Evict the least recently used entry from its hash bucket */
+			entryIndex = this->widthCacheLast;
+			entry = &this->widthCache[entryIndex];
+
+			uint16_t *link = &this->widthCacheBuckets[entry->textHash & (FTGX_WIDTH_CACHE_BUCKETS - 1)];
+			while(*link != entryIndex) {
+				link = &this->widthCache[*link].hashNext;
+			}
+			*link = entry->hashNext;
+
+			this->widthCacheLast = entry->usedPrev;
+			if(this->widthCacheLast != FTGX_WIDTH_CACHE_NONE) {
+				this->widthCache[this->widthCacheLast].usedNext = FTGX_WIDTH_CACHE_NONE;
+			}
+			else {
+				this->widthCacheFirst = FTGX_WIDTH_CACHE_NONE;
+			}
+		}
+
+		entry->textHash = textHash;
+		memcpy(entry->text, text, textLength * sizeof(wchar_t));
+		entry->textLength = textLength;
+		entry->textSize = this->renderSize;
+		entry->textWidth = this->getWidth(text);
+		entry->hashNext = *bucket;
+		*bucket = entryIndex;
+
+		entry->usedPrev = FTGX_WIDTH_CACHE_NONE;
+		entry->usedNext = this->widthCacheFirst;
+		if(this->widthCacheFirst != FTGX_WIDTH_CACHE_NONE) {
+			this->widthCache[this->widthCacheFirst].usedPrev = entryIndex;
+		}
+		this->widthCacheFirst = entryIndex;
+		if(this->widthCacheLast == FTGX_WIDTH_CACHE_NONE) {
+			this->widthCacheLast = entryIndex;
+		}
+	}
+	else if(entryIndex != this->widthCacheFirst) {
+		/* Move the entry to the front of the usage list */
+		this->widthCache[entry->usedPrev].usedNext = entry->usedNext;
+		if(entry->usedNext != FTGX_WIDTH_CACHE_NONE) {
+			this->widthCache[entry->usedNext].usedPrev = entry->usedPrev;
+		}
+		else {
+			this->widthCacheLast = entry->usedPrev;
+		}
+
+		entry->usedPrev = FTGX_WIDTH_CACHE_NONE;
+		entry->usedNext = this->widthCacheFirst;
+		this->widthCache[this->widthCacheFirst].usedPrev = entryIndex;
+		this->widthCacheFirst = entryIndex;
+	}
+
+	return entry->textWidth;
+}
+
+/**
+ * Sets the character rendered in place of characters unsupported by the font.
+ *
+ * This routine sets the character which is rendered and measured in place of any character for which the font has no glyph
+ * or whose glyph cannot be rendered. Unsupported characters are remembered once they are first encountered so that they
+ * are never looked up within the font again. The replacement may be any character supported by the font such as U+FFFD,
+ * FTGX_REPLACEMENT_NOTDEF in order to use the font's undefined character glyph, which is usually an empty box, or
+ * FTGX_REPLACEMENT_NONE in order to skip unsupported characters entirely. If the replacement character is itself
+ * unsupported by the font unsupported characters are skipped. Note that by default FTGX_REPLACEMENT_NOTDEF is used.
+ *
+ * @param character	The replacement character.
+ */
+void FreeTypeGX::setReplacementCharacter(wchar_t character) {
+	this->replacementCharacter = character;
+	for(std::vector<ftgxFontSize*>::iterator i = this->fontSizes.begin(); i != this->fontSizes.end(); i++) {
+		(*i)->replacementSlot = 0;
+		(*i)->numberSlotsResolved = false;
+	}
+	this->clearTextWidthCache();
+}
+
+/**
+ * Gets the character rendered in place of characters unsupported by the font.
+ *
+ * This routine gets the character which is currently rendered in place of characters unsupported by the font.
+ *
+ * @return The replacement character.
+ */
+wchar_t FreeTypeGX::getReplacementCharacter() {
+	return this->replacementCharacter;
+}
+
+/**
+ * Adjusts the texture data buffer to necessary width for a given texture format.
+ * 
+ * This routine determines adjusts the given texture width into the required width to hold the necessary texture data for proper alignment.
+ * 
+ * @param textureWidth	The initial guess for the texture width.
+ * @param textureFormat	The texture format to which the data is to be converted.
+ * @return The correctly adjusted texture width.
+ */
+uint16_t FreeTypeGX::adjustTextureWidth(uint16_t textureWidth, uint8_t textureFormat) {
+	uint16_t alignment;
+	
+	switch(textureFormat) {
+		case GX_TF_I4:		/* 8x8 Tiles - 4-bit Intensity */
+		case GX_TF_I8:		/* 8x4 Tiles - 8-bit Intensity */
+		case GX_TF_IA4:		/* 8x4 Tiles - 4-bit Intensity, , 4-bit Alpha */
+			alignment = 8;
+			break;
+
+		case GX_TF_IA8:		/* 4x4 Tiles - 8-bit Intensity, 8-bit Alpha */
+		case GX_TF_RGB565:	/* 4x4 Tiles - RGB565 Format */
+		case GX_TF_RGB5A3:	/* 4x4 Tiles - RGB5A3 Format */
+		case GX_TF_RGBA8:	/* 4x4 Tiles - RGBA8 Dual Cache Line Format */
+		default:
+			alignment = 4;
+			break;
+	}
+	return textureWidth % alignment == 0 ? textureWidth : alignment + textureWidth - (textureWidth % alignment);
+
+}
+
+/**
+ * Adjusts the texture data buffer to necessary height for a given texture format.
+ * 
+ * This routine determines adjusts the given texture height into the required height to hold the necessary texture data for proper alignment.
+ * 
+ * @param textureHeight	The initial guess for the texture height.
+ * @param textureFormat	The texture format to which the data is to be converted.
+ * @return The correctly adjusted texture height.
+ */
+uint16_t FreeTypeGX::adjustTextureHeight(uint16_t textureHeight, uint8_t textureFormat) {
+	uint16_t alignment;
+	
+	switch(textureFormat) {
+		case GX_TF_I4:		/* 8x8 Tiles - 4-bit Intensity */
+			alignment = 8;
+			break;
+
+		case GX_TF_I8:		/* 8x4 Tiles - 8-bit Intensity */
+		case GX_TF_IA4:		/* 8x4 Tiles - 4-bit Intensity, , 4-bit Alpha */
+		case GX_TF_IA8:		/* 4x4 Tiles - 8-bit Intensity, 8-bit Alpha */
+		case GX_TF_RGB565:	/* 4x4 Tiles - RGB565 Format */
+		case GX_TF_RGB5A3:	/* 4x4 Tiles - RGB5A3 Format */
+		case GX_TF_RGBA8:	/* 4x4 Tiles - RGBA8 Dual Cache Line Format */
+		default:
+			alignment = 4;
+			break;
+	}
+	return textureHeight % alignment == 0 ? textureHeight : alignment + textureHeight - (textureHeight % alignment);
+
+}
+
+/**
+ * Calculates the size of a texture data buffer for a given texture format.
+ * 
+ * This routine determines the number of bytes required to hold a texture of the given tile aligned dimensions.
+ * 
+ * @param textureWidth	The adjusted texture width.
+ * @param textureHeight	The adjusted texture height.
+ * @param textureFormat	The texture format of the data.
+ * @return The size of the texture data in bytes.
+ */
+uint32_t FreeTypeGX::getTextureSize(uint16_t textureWidth, uint16_t textureHeight, uint8_t textureFormat) {
+	uint32_t texturePixels = textureWidth * textureHeight;
+
+	switch(textureFormat) {
+		case GX_TF_I4:		/* 4 bits per pixel */
+			return texturePixels >> 1;
+
+		case GX_TF_I8:		/* 8 bits per pixel */
+		case GX_TF_IA4:
+			return texturePixels;
+
+		case GX_TF_IA8:		/* 16 bits per pixel */
+		case GX_TF_RGB565:
+		case GX_TF_RGB5A3:
+			return texturePixels << 1;
+
+		case GX_TF_RGBA8:	/* 32 bits per pixel */
+		default:
+			return texturePixels << 2;
+	}
+}
+
+/**
+ * Locates the glyph slot of a character within the glyph table.
+ * 
+ * This routine performs a constant time lookup of the supplied character within the glyph table.
+ * 
+ * @param character	The character whose glyph slot should be located.
+ * @return One more than the index of the character's glyph data, or zero if the character has not been cached.
+ */
+uint16_t FreeTypeGX::findGlyphSlot(wchar_t character) {
+	uint32_t charCode = (uint32_t)character;
+	uint16_t *block;
+
+	if(charCode < 0x10000) {
+		block = this->fontSize->glyphTable.basicBlocks[charCode / FTGX_GLYPH_BLOCK_SIZE];
+	}
+	else {
+		uint32_t plane = (charCode >> 16) - 1;
+		if(plane >= FTGX_GLYPH_PLANES || this->fontSize->glyphTable.planeBlocks[plane] == NULL) {
+			return 0;
+		}
+		block = this->fontSize->glyphTable.planeBlocks[plane][(charCode & 0xffff) / FTGX_GLYPH_BLOCK_SIZE];
+	}
+
+	return block != NULL ? block[charCode % FTGX_GLYPH_BLOCK_SIZE] : 0;
+}
+
+/**
+ * Locates or creates the glyph slot of a character within the glyph table.
+ * 
+ * This routine allocates any block or block directory of the glyph table which is required to hold the supplied character.
+ * 
+ * @param character	The character whose glyph slot should be located.
+ * @return A pointer to the character's glyph slot, or NULL if the character lies outside the Unicode range.
+ */
+uint16_t* FreeTypeGX::allocateGlyphSlot(wchar_t character) {
+	uint32_t charCode = (uint32_t)character;
+	uint16_t **block;
+
+	if(charCode < 0x10000) {
+		block = &this->fontSize->glyphTable.basicBlocks[charCode / FTGX_GLYPH_BLOCK_SIZE];
+	}
+	else {
+		uint32_t plane = (charCode >> 16) - 1;
+		if(plane >= FTGX_GLYPH_PLANES) {
+			return NULL;
+		}
+		if(this->fontSize->glyphTable.planeBlocks[plane] == NULL) {
+			this->fontSize->glyphTable.planeBlocks[plane] = (uint16_t **)calloc(0x10000 / FTGX_GLYPH_BLOCK_SIZE, sizeof(uint16_t *));
+		}
+		block = &this->fontSize->glyphTable.planeBlocks[plane][(charCode & 0xffff) / FTGX_GLYPH_BLOCK_SIZE];
+	}
+
+	if(*block == NULL) {
+		*block = (uint16_t *)calloc(FTGX_GLYPH_BLOCK_SIZE, sizeof(uint16_t));
+	}
+
+	return &(*block)[charCode % FTGX_GLYPH_BLOCK_SIZE];
+}
+
+/**
+ * Clears all glyph slots from a glyph table.
+ * 
+ * This routine frees all blocks and block directories of the glyph table back to the system.
+ * 
+ * @param glyphTable	The glyph table to clear.
+ */
+void FreeTypeGX::clearGlyphTable(ftgxGlyphTable *glyphTable) {
+	for(uint16_t blockIndex = 0; blockIndex < 0x10000 / FTGX_GLYPH_BLOCK_SIZE; blockIndex++) {
+		free(glyphTable->basicBlocks[blockIndex]);
+	}
+
+	for(uint16_t plane = 0; plane < FTGX_GLYPH_PLANES; plane++) {
+		if(glyphTable->planeBlocks[plane] != NULL) {
+			for(uint16_t blockIndex = 0; blockIndex < 0x10000 / FTGX_GLYPH_BLOCK_SIZE; blockIndex++) {
+				free(glyphTable->planeBlocks[plane][blockIndex]);
+			}
+			free(glyphTable->planeBlocks[plane]);
+		}
+	}
+
+	memset(glyphTable, 0x00, sizeof(ftgxGlyphTable));
+}
+
+/**
+ * Caches the given font glyph in the instance font texture buffer.
+ *
+ * This routine renders and stores the requested glyph's bitmap and relevant information into its own quickly addressable
+ * slot within the instance-specific glyph metrics and texture arrays.
+ * 
+ * @param charCode	The requested glyph's character code.
+ * @return A pointer to the allocated font structure.
+ */
+ftgxCharData *FreeTypeGX::cacheGlyphData(wchar_t charCode) {
+	FT_UInt gIndex;
+
+	uint16_t *glyphSlot = this->allocateGlyphSlot(charCode);
+	if(glyphSlot == NULL) {
+		return this->getReplacementGlyph();
+	}
+
+	gIndex = this->ftFace != NULL ? FT_Get_Char_Index( this->ftFace, charCode ) : 0;
+	*glyphSlot = gIndex != 0 ? this->cacheGlyphIndex(gIndex) : FTGX_GLYPH_MISSING;
+
+	if(*glyphSlot == FTGX_GLYPH_MISSING) {
+		return this->getReplacementGlyph();
+	}
+
+	return &this->fontSize->glyphMetrics[*glyphSlot - 1];
+}
+
+/**
+ * Caches the metrics of the given font glyph index.
+ *
+ * This routine loads the requested glyph without rendering it and stores its metrics into a new slot within the
+ * instance-specific glyph metrics and texture arrays. The bitmap bounds are derived from the control box of the glyph
+ * outline in the same manner as the FreeType rasterizer so that no bitmap needs to be produced until the glyph is drawn.
+ * 
+ * @param gIndex	The requested glyph's index within the font face.
+ * @return One more than the index of the new glyph data, or FTGX_GLYPH_MISSING if the glyph could not be loaded.
+ */
+uint16_t FreeTypeGX::cacheGlyphIndex(FT_UInt gIndex) {
+	uint16_t textureWidth = 0, textureHeight = 0;
+	int16_t bitmapTop = 0;
+	uint16_t padding = this->fontSize->texturePadding;
+
+	if(this->fontSize->glyphMetrics.size() >= FTGX_GLYPH_MISSING - 1) {
+		return FTGX_GLYPH_MISSING;
+	}
+
+	if(!this->loadGlyph(gIndex)) {
+		return FTGX_GLYPH_MISSING;
+	}
+
+	FT_GlyphSlot glyph = this->ftFace->glyph;
+	switch(glyph->format) {
+		case FT_GLYPH_FORMAT_BITMAP:
+			textureWidth = glyph->bitmap.width;
+			textureHeight = glyph->bitmap.rows;
+			bitmapTop = glyph->bitmap_top;
+			break;
+
+		case FT_GLYPH_FORMAT_OUTLINE: {
+			FT_BBox outlineBox;
+			FT_Outline_Get_CBox(&glyph->outline, &outlineBox);
+
+			outlineBox.xMin &= -64;
+			outlineBox.yMin &= -64;
+			outlineBox.xMax = (outlineBox.xMax + 63) & -64;
+			outlineBox.yMax = (outlineBox.yMax + 63) & -64;
+
+			textureWidth = (outlineBox.xMax - outlineBox.xMin) >> 6;
+			textureHeight = (outlineBox.yMax - outlineBox.yMin) >> 6;
+			bitmapTop = outlineBox.yMax >> 6;
+			break;
+		}
+
+		default:
+			return FTGX_GLYPH_MISSING;
+	}
+
+	if(textureWidth && textureHeight) {
+		textureWidth = adjustTextureWidth(textureWidth + (padding << 1), this->textureFormat);
+		textureHeight = adjustTextureHeight(textureHeight + (padding << 1), this->textureFormat);
+	}
+
+	this->fontSize->glyphMetrics.push_back(buildGlyphMetrics(glyph, gIndex, textureHeight, bitmapTop, padding));
+	this->fontSize->glyphTextures.push_back((ftgxCharTexture){
+		textureWidth,
+		textureHeight,
+		(uint16_t)(textureWidth && textureHeight ? FTGX_TEXTURE_PENDING : 0),
+		0.0f, 0.0f, 0.0f, 0.0f
+	});
+
+	return this->fontSize->glyphMetrics.size();
+}
+
+/**
+ * Renders the texture of a glyph whose metrics have already been cached.
+ *
+ * This routine renders the requested glyph's bitmap and loads it into the texture atlas. The glyph is only reloaded from the
+ * font face if it is not still held by the face's glyph slot from the caching of its metrics. Should the glyph fail to render
+ * it is given an empty texture so that it is never rendered again. Distance field glyphs are converted into a distance
+ * field surrounded by texturePadding pixels on each side before being loaded.
+ * 
+ * @param charData	A pointer to the ftgxCharData structure of the glyph.
+ * @param charTexture	A pointer to the ftgxCharTexture structure of the glyph.
+ */
+void FreeTypeGX::cacheGlyphTexture(ftgxCharData *charData, ftgxCharTexture *charTexture) {
+	*charTexture = (ftgxCharTexture){ 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f };
+
+	if(this->ftLoadedGlyph != charData->glyphIndex && !this->loadGlyph(charData->glyphIndex)) {
+		return;
+	}
+	if(FT_Render_Glyph(this->ftFace->glyph, FT_RENDER_MODE_NORMAL) || this->ftFace->glyph->format != FT_GLYPH_FORMAT_BITMAP) {
+		return;
+	}
+
+	FT_Bitmap *glyphBitmap = &(this->ftFace->glyph->bitmap);
+	FT_Bitmap fieldBitmap;
+	uint16_t padding = this->fontSize->texturePadding;
+
+	if(padding && glyphBitmap->width && glyphBitmap->rows) {
+		createDistanceField(glyphBitmap, padding, &fieldBitmap);
+		glyphBitmap = &fieldBitmap;
+	}
+
+	charTexture->textureWidth = adjustTextureWidth(glyphBitmap->width, this->textureFormat);
+	charTexture->textureHeight = adjustTextureHeight(glyphBitmap->rows, this->textureFormat);
+
+	charData->renderOffsetY = this->ftFace->glyph->bitmap_top + padding;
+	charData->renderOffsetMax = this->ftFace->glyph->bitmap_top;
+	charData->renderOffsetMin = charTexture->textureHeight - (padding << 1) - this->ftFace->glyph->bitmap_top;
+
+	this->loadGlyphData(glyphBitmap, charTexture);
+
+	if(glyphBitmap == &fieldBitmap) {
+		free(fieldBitmap.buffer);
+	}
+}
+
+/**
+ * Loads a glyph into the glyph slot of the font face.
+ *
+ * This routine loads the requested glyph without rendering it and records which glyph is currently held by the glyph slot.
+ * 
+ * @param gIndex	The requested glyph's index within the font face.
+ * @return True if the glyph was loaded successfully.
+ */
+bool FreeTypeGX::loadGlyph(FT_UInt gIndex) {
+	FT_Int32 loadFlags = this->fontSize->subpixelPhases > 1 ? FT_LOAD_NO_HINTING : FT_LOAD_DEFAULT;
+
+	if(this->ftFace == NULL || FT_Load_Glyph(this->ftFace, gIndex, loadFlags)) {
+		this->ftLoadedGlyph = FTGX_GLYPH_NONE;
+		return false;
+	}
+
+	this->ftLoadedGlyph = gIndex;
+	return true;
+}
+
+/**
+ * Locates each character in this wrapper's configured font face and process them.
+ *
+ * This routine locates each character in the configured font face and renders the glyph's bitmap.
+ * Each bitmap and relevant information is loaded into its own quickly addressable structure within an instance-specific map.
+ */
+uint16_t FreeTypeGX::cacheGlyphDataComplete() {
+	uint8_t threadCount = this->getCacheThreadCount();
+	if(threadCount > 1 && this->fontSize->texturePadding == 0 && this->fontSize->subpixelPhases == 1) {
+		return this->cacheGlyphDataParallel(threadCount);
+	}
+
+	uint16_t i = 0;
+	FT_UInt gIndex;
+	FT_ULong charCode = FT_Get_First_Char( this->ftFace, &gIndex );
+	while ( gIndex != 0 ) {
+
+		ftgxCharData *glyphData = this->getCharacter(charCode);
+		uint16_t glyphSlot = this->findGlyphSlot(charCode);
+
+		if(glyphSlot != 0 && glyphSlot != FTGX_GLYPH_MISSING) {
+			this->getCharacterTexture(glyphData);
+			i++;
+		}
+
+		charCode = FT_Get_Next_Char( this->ftFace, charCode, &gIndex );
+	}
+	
+	return i;
+}
+
+/**
+ * Enables or disables asynchronous glyph caching.
+ * 
+ * When enabled glyph textures which have not yet been rendered are no longer rendered within drawText. Instead they are
+ * queued for rendering by a background thread with a font face of its own, and drawText leaves a gap of the glyph's
+ * advance width in their place until the rendered textures are loaded into the texture atlas by a subsequent drawText
+ * call. Glyph metrics are still cached immediately so that text layout and widths never change as glyphs arrive. This
+ * bounds the time spent within drawText regardless of the number of new characters in the text.
+ * 
+ * @param enabled	The enabled state of asynchronous glyph caching.
+ * @return The enabled state of asynchronous glyph caching.
+ */
+bool FreeTypeGX::setAsyncCachingEnabled(bool enabled) {
+	if(!enabled) {
+		this->stopAsyncCaching();
+	}
+
+	return this->asyncCachingEnabled = enabled;
+}
+
+/**
+ * Gets the enabled state of asynchronous glyph caching.
+ * 
+ * @return The enabled state of asynchronous glyph caching.
+ */
+bool FreeTypeGX::getAsyncCachingEnabled() {
+	return this->asyncCachingEnabled;
+}
+
+/**
+ * Gets the number of glyphs whose textures are not yet available due to asynchronous glyph caching.
+ * 
+ * @return The number of glyphs awaiting rendering or loading into the texture atlas.
+ */
+uint32_t FreeTypeGX::getAsyncPendingCount() {
+	if(!this->asyncThreadRunning) {
+		return 0;
+	}
+
+	lockMutex(&this->asyncMutex);
+	uint32_t pendingCount = this->asyncRequests.size() + this->asyncCompleted.size();
+	unlockMutex(&this->asyncMutex);
+
+	return pendingCount;
+}
+
+/**
+ * Queues the texture of a glyph for rendering by the asynchronous caching thread.
+ * 
+ * This routine starts the asynchronous caching thread if it is not yet running and adds the glyph to its request queue.
+ * 
+ * @param charData	A pointer to the ftgxCharData structure of the glyph within the active point size.
+ * @return True if the glyph was queued, false if it must be rendered synchronously.
+ */
+bool FreeTypeGX::queueGlyphTexture(ftgxCharData *charData) {
+	if(this->ftFace == NULL || this->fontSize->ftSize == NULL) {
+		return false;
+	}
+
+	if(!this->asyncThreadRunning) {
+		this->asyncThreadStop = false;
+		this->asyncThreadFailed = false;
+		if(!startThread(&this->asyncThread, asyncCachingThread, this)) {
+			return false;
+		}
+		this->asyncThreadRunning = true;
+	}
+
+	lockMutex(&this->asyncMutex);
+	this->asyncRequests.push_back((ftgxAsyncGlyph){
+		this->fontSize->sizeSerial,
+		this->fontSize->pointSize,
+		charData->glyphIndex,
+		(uint16_t)(charData - &this->fontSize->glyphMetrics[0] + 1),
+		false, 0, 0, 0, NULL
+	});
+	signalCond(&this->asyncCond);
+	unlockMutex(&this->asyncMutex);
+
+	return true;
+}
+
+/**
+ * Loads glyphs rendered by the asynchronous caching thread into the texture atlas.
+ * 
+ * This routine takes up to FTGX_ASYNC_PUBLISH_LIMIT rendered glyphs from the completed queue and loads them into the texture
+ * atlas of their point size. Glyphs whose point size has since been released are discarded. Should the asynchronous caching
+ * thread have failed to create its font face, asynchronous caching is disabled and the queued glyphs are returned to the
+ * unrendered state so that they are rendered synchronously when drawn.
+ */
+void FreeTypeGX::publishAsyncGlyphs() {
+	ftgxAsyncGlyph glyphs[FTGX_ASYNC_PUBLISH_LIMIT];
+	uint16_t glyphCount = 0;
+
+	lockMutex(&this->asyncMutex);
+	if(this->asyncThreadFailed) {
+		unlockMutex(&this->asyncMutex);
+		this->stopAsyncCaching();
+		this->asyncCachingEnabled = false;
+		return;
+	}
+	while(glyphCount < FTGX_ASYNC_PUBLISH_LIMIT && !this->asyncCompleted.empty()) {
+		glyphs[glyphCount++] = this->asyncCompleted.front();
+		this->asyncCompleted.pop_front();
+	}
+	unlockMutex(&this->asyncMutex);
+
+	ftgxFontSize *activeSize = this->fontSize;
+
+	for(ftgxAsyncGlyph *glyph = glyphs; glyph < glyphs + glyphCount; glyph++) {
+		for(std::vector<ftgxFontSize*>::iterator i = this->fontSizes.begin(); i != this->fontSizes.end(); i++) {
+			if((*i)->sizeSerial != glyph->sizeSerial) {
+				continue;
+			}
+
+			ftgxCharData *charData = &(*i)->glyphMetrics[glyph->glyphSlot - 1];
+			ftgxCharTexture *charTexture = &(*i)->glyphTextures[glyph->glyphSlot - 1];
+
+			if(charTexture->texturePage == FTGX_TEXTURE_QUEUED) {
+				*charTexture = (ftgxCharTexture){ 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f };
+
+				if(glyph->glyphLoaded) {
+					charData->renderOffsetY = glyph->bitmapTop;
+					charData->renderOffsetMax = glyph->bitmapTop;
+					charData->renderOffsetMin = glyph->textureHeight - glyph->bitmapTop;
+
+					if(glyph->textureData != NULL) {
+						uint16_t textureX, textureY;
+
+						this->fontSize = *i;
+						charTexture->textureWidth = glyph->textureWidth;
+						charTexture->textureHeight = glyph->textureHeight;
+						charTexture->texturePage = this->allocateTextureRegion(glyph->textureWidth, glyph->textureHeight, &textureX, &textureY);
+						this->copyTextureToPage(glyph->textureData, charTexture, textureX, textureY);
+					}
+				}
+			}
+			break;
+		}
+
+		free(glyph->textureData);
+	}
+
+	this->fontSize = activeSize;
+}
+
+/**
+ * Stops the asynchronous caching thread.
+ * 
+ * This routine waits for the asynchronous caching thread to exit and discards both queues. Glyphs which were queued but
+ * not yet loaded into the texture atlas are returned to the unrendered state so that they are requested again when drawn.
+ */
+void FreeTypeGX::stopAsyncCaching() {
+	if(!this->asyncThreadRunning) {
+		return;
+	}
+
+	lockMutex(&this->asyncMutex);
+	this->asyncThreadStop = true;
+	signalCond(&this->asyncCond);
+	unlockMutex(&this->asyncMutex);
+
+	joinThread(this->asyncThread);
+	this->asyncThreadRunning = false;
+
+	for(std::deque<ftgxAsyncGlyph>::iterator i = this->asyncCompleted.begin(); i != this->asyncCompleted.end(); i++) {
+		free(i->textureData);
+	}
+	this->asyncRequests.clear();
+	this->asyncCompleted.clear();
+
+	for(std::vector<ftgxFontSize*>::iterator i = this->fontSizes.begin(); i != this->fontSizes.end(); i++) {
+		for(std::vector<ftgxCharTexture>::iterator j = (*i)->glyphTextures.begin(); j != (*i)->glyphTextures.end(); j++) {
+			if(j->texturePage == FTGX_TEXTURE_QUEUED) {
+				j->texturePage = FTGX_TEXTURE_PENDING;
+			}
+		}
+	}
+}
+
+/**
+ * Entry point of the asynchronous caching thread.
+ * 
+ * @param instance	A pointer to the FreeTypeGX instance which started the thread.
+ * @return Always NULL.
+ */
+void* FreeTypeGX::asyncCachingThread(void *instance) {
+	((FreeTypeGX *)instance)->processAsyncRequests();
+	return NULL;
+}
+
+/**
+ * Renders the glyphs of the request queue until the thread is asked to exit.
+ * 
+ * This routine runs on the asynchronous caching thread. It creates a FreeType library instance and font face of its own
+ * from the font buffer of the instance and moves each rendered and converted glyph from the request queue to the completed
+ * queue. Only the queues are accessed under the lock; the glyph caches are only ever modified by the calling thread. Should
+ * the font face not be created the thread exits at once, leaving the request queue untouched, and reports the failure
+ * through asyncThreadFailed.
+ */
+void FreeTypeGX::processAsyncRequests() {
+	FT_Library library = NULL;
+	FT_Face face = NULL;
+	FT_UInt pointSize = 0;
+
+	if(FT_Init_FreeType(&library)) {
+		library = NULL;
+	}
+	else if(FT_New_Memory_Face(library, this->ftFontBuffer, this->ftFontBufferSize, 0, &face)) {
+		face = NULL;
+	}
+
+	lockMutex(&this->asyncMutex);
+	this->asyncThreadFailed = face == NULL;
+	while(!this->asyncThreadFailed) {
+		while(this->asyncRequests.empty() && !this->asyncThreadStop) {
+			waitCond(&this->asyncCond, &this->asyncMutex);
+		}
+		if(this->asyncThreadStop) {
+			break;
+		}
+
+		ftgxAsyncGlyph glyph = this->asyncRequests.front();
+		this->asyncRequests.pop_front();
+		unlockMutex(&this->asyncMutex);
+
+		if(glyph.pointSize != pointSize) {
+			pointSize = FT_Set_Pixel_Sizes(face, 0, glyph.pointSize) ? 0 : glyph.pointSize;
+		}
+
+		if(glyph.pointSize == pointSize
+			&& !FT_Load_Glyph(face, glyph.glyphIndex, FT_LOAD_RENDER) && face->glyph->format == FT_GLYPH_FORMAT_BITMAP) {
+			FT_Bitmap *glyphBitmap = &face->glyph->bitmap;
+
+			glyph.textureWidth = adjustTextureWidth(glyphBitmap->width, this->textureFormat);
+			glyph.textureHeight = adjustTextureHeight(glyphBitmap->rows, this->textureFormat);
+			glyph.bitmapTop = face->glyph->bitmap_top;
+			if(glyph.textureWidth && glyph.textureHeight) {
+				glyph.textureData = convertGlyphBitmap(glyphBitmap, glyph.textureWidth, glyph.textureHeight, this->textureFormat);
+			}
+			glyph.glyphLoaded = true;
+		}
+
+		lockMutex(&this->asyncMutex);
+		this->asyncCompleted.push_back(glyph);
+	}
+	unlockMutex(&this->asyncMutex);
+
+	if(library != NULL) {
+		FT_Done_FreeType(library);
+	}
+}
+
+/**
+ * Begins an incremental precache of the active point size.
+ * 
+ * This routine records the characters to be cached by subsequent precacheStep calls, replacing any precache already in
+ * progress. Unlike caching all characters with loadFont no glyphs are cached by this routine, allowing the work to be spread
+ * across several frames without the use of threads. Characters are cached for whichever point size is active when
+ * precacheStep is called.
+ * 
+ * @param charset	Optional NULL terminated string of the characters to cache. If not specified all characters of the font are cached.
+ * @return The number of characters to be cached.
+ */
+uint32_t FreeTypeGX::beginPrecache(wchar_t *charset) {
+	this->precacheChars.clear();
+	this->precacheIndex = 0;
+
+	if(charset != NULL) {
+		for(wchar_t *character = charset; *character; character++) {
+			this->precacheChars.push_back(*character);
+		}
+	}
+	else if(this->ftFace != NULL) {
+		FT_UInt gIndex;
+		FT_ULong charCode = FT_Get_First_Char( this->ftFace, &gIndex );
+		while ( gIndex != 0 ) {
+			this->precacheChars.push_back(charCode);
+			charCode = FT_Get_Next_Char( this->ftFace, charCode, &gIndex );
+		}
+	}
+
+	return this->precacheChars.size();
+}
+
+/**
+ * 
+ * \overload
+ */
+uint32_t FreeTypeGX::beginPrecache(wchar_t const *charset) {
+	return this->beginPrecache((wchar_t *)charset);
+}
+
+/**
+ * Continues the incremental precache begun with beginPrecache.
+ * 
+ * This routine caches the metrics and textures of the remaining precache characters until the given time budget has been
+ * used up. At least one character is cached per call so that the precache always progresses. Characters already cached
+ * are skipped at negligible cost.
+ * 
+ * @param microsecondBudget	The time in microseconds which may be spent caching characters.
+ * @return True if all characters have been cached, false if characters remain.
+ */
+bool FreeTypeGX::precacheStep(uint32_t microsecondBudget) {
+	if(this->fontSize == NULL) {
+		return this->precacheIndex >= this->precacheChars.size();
+	}
+
+	uint64_t startTime = getTimestamp();
+
+	while(this->precacheIndex < this->precacheChars.size()) {
+		ftgxCharData *glyphData = this->getCharacter(this->precacheChars[this->precacheIndex++]);
+		if(glyphData != NULL) {
+			this->getCharacterTexture(glyphData);
+		}
+
+		if(getElapsedMicroseconds(startTime) >= microsecondBudget) {
+			break;
+		}
+	}
+
+	if(this->precacheIndex >= this->precacheChars.size()) {
+		this->precacheChars.clear();
+		this->precacheIndex = 0;
+		return true;
+	}
+
+	return false;
+}
+
+/**
+ * Gets the progress of the incremental precache begun with beginPrecache.
+ * 
+ * @return The fraction of the precache characters already cached, between 0.0 and 1.0. If no precache is in progress 1.0 is returned.
+ */
+f32 FreeTypeGX::getPrecacheProgress() {
+	if(this->precacheChars.empty()) {
+		return 1.0f;
+	}
+
+	return (f32)this->precacheIndex / this->precacheChars.size();
+}
+
+/**
+ * Locates each character in this wrapper's configured font face and processes them using several worker threads.
+ *
+ * This routine gathers the uncached characters of the configured font face into batches of FTGX_RASTER_BATCH_SIZE glyphs
+ * which are rendered concurrently by cacheRasterBatch.
+ * 
+ * @param threadCount	The number of worker threads.
+ * @return The number of characters which were cached.
+ */
+uint16_t FreeTypeGX::cacheGlyphDataParallel(uint8_t threadCount) {
+	uint16_t i = 0;
+	std::vector<ftgxRasterGlyph> batch;
+	FT_UInt gIndex;
+	FT_ULong charCode = FT_Get_First_Char( this->ftFace, &gIndex );
+	while ( gIndex != 0 ) {
+
+		uint16_t glyphSlot = this->findGlyphSlot(charCode);
+		if(glyphSlot == 0) {
+			ftgxRasterGlyph glyph;
+			memset(&glyph, 0x00, sizeof(ftgxRasterGlyph));
+			glyph.charCode = (uint32_t)charCode;
+			glyph.glyphIndex = gIndex;
+			batch.push_back(glyph);
+		}
+		else if(glyphSlot != FTGX_GLYPH_MISSING) {
+			i++;
+		}
+
+		charCode = FT_Get_Next_Char( this->ftFace, charCode, &gIndex );
+
+		if(batch.size() == FTGX_RASTER_BATCH_SIZE || (gIndex == 0 && !batch.empty())) {
+			i += this->cacheRasterBatch(&batch[0], batch.size(), threadCount);
+			batch.clear();
+		}
+	}
+
+	return i;
+}
+
+/**
+ * Renders a batch of glyphs using several worker threads and stores them into the glyph caches.
+ *
+ * This routine shares the batch among the worker threads, with the calling thread acting as the first worker, and waits
+ * for all of them to finish. The rendered glyphs are then stored into the glyph caches and texture atlas in batch order.
+ * Glyphs which a worker failed to render are cached on the calling thread in the same manner as on demand caching.
+ * 
+ * @param glyphs	The glyphs of the batch.
+ * @param glyphCount	The number of glyphs in the batch.
+ * @param threadCount	The number of worker threads.
+ * @return The number of characters which were cached.
+ */
+uint16_t FreeTypeGX::cacheRasterBatch(ftgxRasterGlyph *glyphs, uint32_t glyphCount, uint8_t threadCount) {
+	ftgxRasterShard shards[FTGX_RASTER_MAX_THREADS];
+	ftgxThread threads[FTGX_RASTER_MAX_THREADS];
+	bool threadStarted[FTGX_RASTER_MAX_THREADS];
+	uint16_t i = 0;
+
+	for(uint8_t shardIndex = 0; shardIndex < threadCount; shardIndex++) {
+		shards[shardIndex] = (ftgxRasterShard){ this->ftFontBuffer, this->ftFontBufferSize, this->fontSize->pointSize, this->textureFormat, glyphs, glyphCount, shardIndex, threadCount };
+		threadStarted[shardIndex] = shardIndex != 0 && startThread(&threads[shardIndex], rasterGlyphShard, &shards[shardIndex]);
+	}
+	for(uint8_t shardIndex = 0; shardIndex < threadCount; shardIndex++) {
+		if(!threadStarted[shardIndex]) {
+			rasterGlyphShard(&shards[shardIndex]);
+		}
+	}
+	for(uint8_t shardIndex = 0; shardIndex < threadCount; shardIndex++) {
+		if(threadStarted[shardIndex]) {
+			joinThread(threads[shardIndex]);
+		}
+	}
+
+	for(ftgxRasterGlyph *glyph = glyphs; glyph < glyphs + glyphCount; glyph++) {
+		if(!glyph->glyphLoaded) {
+			ftgxCharData *glyphData = this->getCharacter(glyph->charCode);
+			uint16_t glyphSlot = this->findGlyphSlot(glyph->charCode);
+
+			if(glyphSlot != 0 && glyphSlot != FTGX_GLYPH_MISSING) {
+				this->getCharacterTexture(glyphData);
+				i++;
+			}
+			continue;
+		}
+
+		uint16_t *glyphSlot = this->allocateGlyphSlot(glyph->charCode);
+		if(glyphSlot != NULL) {
+			if(this->fontSize->glyphMetrics.size() >= FTGX_GLYPH_MISSING - 1) {
+				*glyphSlot = FTGX_GLYPH_MISSING;
+			}
+			else {
+				this->fontSize->glyphMetrics.push_back(glyph->glyphMetrics);
+				this->fontSize->glyphTextures.push_back((ftgxCharTexture){ 0, 0, 0, 0.0f, 0.0f, 0.0f, 0.0f });
+				*glyphSlot = this->fontSize->glyphMetrics.size();
+
+				if(glyph->textureData != NULL) {
+					ftgxCharTexture *charTexture = &this->fontSize->glyphTextures.back();
+					uint16_t textureX, textureY;
+
+					charTexture->textureWidth = glyph->textureWidth;
+					charTexture->textureHeight = glyph->textureHeight;
+					charTexture->texturePage = this->allocateTextureRegion(glyph->textureWidth, glyph->textureHeight, &textureX, &textureY);
+					this->copyTextureToPage(glyph->textureData, charTexture, textureX, textureY);
+				}
+				i++;
+			}
+		}
+
+		free(glyph->textureData);
+	}
+
+	return i;
+}
+
+/**
+ * Renders a share of a glyph batch.
+ *
+ * This routine is the entry point of the worker threads. It creates a FreeType library instance and font face of its own
+ * from the shared font buffer and renders and converts each glyph of its share of the batch into the target texture format.
+ * 
+ * @param shard	A pointer to the ftgxRasterShard structure describing the share of the batch.
+ * @return Always NULL.
+ */
+void* FreeTypeGX::rasterGlyphShard(void *shard) {
+	ftgxRasterShard *rasterShard = (ftgxRasterShard *)shard;
+	FT_Library library;
+	FT_Face face;
+
+	if(FT_Init_FreeType(&library)) {
+		return NULL;
+	}
+	if(FT_New_Memory_Face(library, rasterShard->fontBuffer, rasterShard->fontBufferSize, 0, &face) || FT_Set_Pixel_Sizes(face, 0, rasterShard->pointSize)) {
+		FT_Done_FreeType(library);
+		return NULL;
+	}
+
+	for(uint32_t glyphIndex = rasterShard->shardIndex; glyphIndex < rasterShard->glyphCount; glyphIndex += rasterShard->shardCount) {
+		ftgxRasterGlyph *glyph = &rasterShard->glyphs[glyphIndex];
+
+		if(FT_Load_Glyph(face, glyph->glyphIndex, FT_LOAD_RENDER) || face->glyph->format != FT_GLYPH_FORMAT_BITMAP) {
+			continue;
+		}
+
+		FT_Bitmap *glyphBitmap = &face->glyph->bitmap;
+
+		glyph->textureWidth = adjustTextureWidth(glyphBitmap->width, rasterShard->textureFormat);
+		glyph->textureHeight = adjustTextureHeight(glyphBitmap->rows, rasterShard->textureFormat);
+		/* Glyph sets are only rendered in parallel without distance field padding */
+		glyph->glyphMetrics = buildGlyphMetrics(face->glyph, glyph->glyphIndex, glyph->textureHeight, (int16_t)face->glyph->bitmap_top, 0);
+
+		if(glyph->textureWidth && glyph->textureHeight) {
+			glyph->textureData = convertGlyphBitmap(glyphBitmap, glyph->textureWidth, glyph->textureHeight, rasterShard->textureFormat);
+		}
+		glyph->glyphLoaded = true;
+	}
+
+	FT_Done_Face(face);
+	FT_Done_FreeType(library);
+	return NULL;
+}
+
+/**
+ * Loads the rendered bitmap into the texture atlas.
+ * 
+ * This routine converts the glyph's rendered bitmap into the target texture format. The converted texture is then packed
+ * into a texture atlas page and the texture coordinates of the structure are set accordingly.
+ * 
+ * @param bmp	A pointer to the most recently rendered glyph's bitmap.
+ * @param charTexture	A pointer to an allocated ftgxCharTexture structure whose data represent that of the last rendered glyph.
+ */
+void FreeTypeGX::loadGlyphData(FT_Bitmap *bmp, ftgxCharTexture *charTexture) {
+	uint16_t textureX, textureY;
+
+	if(charTexture->textureWidth == 0 || charTexture->textureHeight == 0) {
+		return;
+	}
+
+	uint32_t *glyphTexture = convertGlyphBitmap(bmp, charTexture->textureWidth, charTexture->textureHeight, this->textureFormat);
+
+	charTexture->texturePage = this->allocateTextureRegion(charTexture->textureWidth, charTexture->textureHeight, &textureX, &textureY);
+	this->copyTextureToPage(glyphTexture, charTexture, textureX, textureY);
+
+	free(glyphTexture);
+}
+
+/**
+ * Converts a rendered bitmap into the given texture format.
+ * 
+ * This routine does a simple byte-wise copy of the glyph's rendered 8-bit grayscale bitmap into a temporary buffer.
+ * Each byte is converted from the bitmap's intensity value into the a uint32_t RGBA value. The temporary buffer is then
+ * converted into the target texture format. This routine only accesses its parameters and may be called from worker threads.
+ * 
+ * @param bmp	A pointer to the rendered glyph's bitmap.
+ * @param textureWidth	The tile aligned width of the texture in pixels.
+ * @param textureHeight	The tile aligned height of the texture in pixels.
+ * @param textureFormat	The format (GX_TF_*) of the texture.
+ * @return A newly allocated buffer holding the texture data which must be released with free.
+ */
+uint32_t* FreeTypeGX::convertGlyphBitmap(FT_Bitmap *bmp, uint16_t textureWidth, uint16_t textureHeight, uint8_t textureFormat) {
+	uint32_t *glyphTexture;
+
+	uint32_t *glyphData = (uint32_t *)memalign(32, textureWidth * textureHeight * 4);
+	memset(glyphData, 0x00, textureWidth * textureHeight * 4);
+	
+	uint8_t *src = (uint8_t *)bmp->buffer;
+	uint32_t *dest = glyphData, *ptr = dest;
+
+	uint16_t rows = std::min<uint32_t>(bmp->rows, textureHeight), columns = std::min<uint32_t>(bmp->width, textureWidth);
+	for (uint16_t imagePosY = 0; imagePosY < rows; imagePosY++) {
+		for (uint16_t imagePosX = 0; imagePosX < columns; imagePosX++) {
+			*ptr++ = EXPLODE_UINT8_TO_UINT32(src[imagePosX]);
+		}
+		src += bmp->pitch;
+		ptr = dest += textureWidth;
+	}
+	
+	switch(textureFormat) {
+		case GX_TF_I4:
+			glyphTexture = Metaphrasis::convertBufferToI4(glyphData, textureWidth, textureHeight);
+			break;
+		case GX_TF_I8:
+			glyphTexture = Metaphrasis::convertBufferToI8(glyphData, textureWidth, textureHeight);
+			break;
+		case GX_TF_IA4:
+			glyphTexture = Metaphrasis::convertBufferToIA4(glyphData, textureWidth, textureHeight);
+			break;
+		case GX_TF_IA8:
+			glyphTexture = Metaphrasis::convertBufferToIA8(glyphData, textureWidth, textureHeight);
+			break;
+		case GX_TF_RGB565:
+			glyphTexture = Metaphrasis::convertBufferToRGB565(glyphData, textureWidth, textureHeight);
+			break;
+		case GX_TF_RGB5A3:
+			glyphTexture = Metaphrasis::convertBufferToRGB5A3(glyphData, textureWidth, textureHeight);
+			break;
+		case GX_TF_RGBA8:
+		default:
+			glyphTexture = Metaphrasis::convertBufferToRGBA8(glyphData, textureWidth, textureHeight);
+			break;
+	}
+
+	free(glyphData);
+
+	return glyphTexture;
+}
+
+/**
+ * Converts a rendered bitmap into a signed distance field.
+ * 
+ * This routine thresholds the glyph's coverage at one half and determines the distance of every pixel to the nearest pixel
+ * on the other side of the glyph edge with the eight point sequential Euclidean distance transform. The distance is
+ * mapped to 8 bits with the glyph edge at 128 and the limits of the field spread pixels inside and outside of the edge.
+ * The field is surrounded by spread pixels on each side so that the outside of the glyph fades out completely. This
+ * routine only accesses its parameters and may be called from worker threads.
+ * 
+ * @param bmp	A pointer to the rendered glyph's bitmap.
+ * @param spread	Distance in pixels covered by the field on either side of the glyph edge.
+ * @param field	Output bitmap receiving the distance field, whose buffer must be released with free.
+ */
+void FreeTypeGX::createDistanceField(FT_Bitmap *bmp, uint16_t spread, FT_Bitmap *field) {
+	int32_t width = bmp->width + (spread << 1);
+	int32_t height = bmp->rows + (spread << 1);
+	int32_t pixelCount = width * height;
+
+	ftgxFieldPoint *insidePoints = (ftgxFieldPoint *)memalign(32, pixelCount * sizeof(ftgxFieldPoint));
+	ftgxFieldPoint *outsidePoints = (ftgxFieldPoint *)memalign(32, pixelCount * sizeof(ftgxFieldPoint));
+	ftgxFieldPoint seedPoint = { 0, 0 }, farPoint = { FTGX_DISTANCE_FIELD_FAR, FTGX_DISTANCE_FIELD_FAR };
+
+	for(int32_t y = 0; y < height; y++) {
+		for(int32_t x = 0; x < width; x++) {
+			int32_t bitmapX = x - spread, bitmapY = y - spread;
+			bool covered = bitmapX >= 0 && bitmapY >= 0 && bitmapX < (int32_t)bmp->width && bitmapY < (int32_t)bmp->rows
+				&& bmp->buffer[bitmapY * bmp->pitch + bitmapX] >= 0x80;
+
+			insidePoints[y * width + x] = covered ? seedPoint : farPoint;
+			outsidePoints[y * width + x] = covered ? farPoint : seedPoint;
+		}
+	}
+
+	propagateDistanceField(insidePoints, width, height);
+	propagateDistanceField(outsidePoints, width, height);
+
+	memset(field, 0x00, sizeof(FT_Bitmap));
+	field->width = width;
+	field->rows = height;
+	field->pitch = width;
+	field->num_grays = 256;
+	field->pixel_mode = FT_PIXEL_MODE_GRAY;
+	field->buffer = (unsigned char *)memalign(32, pixelCount);
+
+	for(int32_t i = 0; i < pixelCount; i++) {
+		bool inside = insidePoints[i].offsetX == 0 && insidePoints[i].offsetY == 0;
+		ftgxFieldPoint *point = inside ? &outsidePoints[i] : &insidePoints[i];
+		f32 distance = sqrtf(point->offsetX * point->offsetX + point->offsetY * point->offsetY) - 0.5f;
+		int32_t value = 128 + (int32_t)((inside ? distance : -distance) * 128.0f / spread);
+
+		field->buffer[i] = value < 0 ? 0 : (value > 255 ? 255 : value);
+	}
+
+	free(insidePoints);
+	free(outsidePoints);
+}
+
+/**
+ * Scales a metric of the active glyph caches to the requested point size.
+ * 
+ * @param value	The metric in pixels of the active glyph caches.
+ * @return The metric in pixels of the requested point size, rounded to the nearest pixel.
+ */
+int16_t FreeTypeGX::scaleMetric(int32_t value) {
+	if(this->renderScale == 1.0f) {
+		return value;
+	}
+
+	return (int16_t)floorf(value * this->renderScale + 0.5f);
+}
+
+/**
+ * Scales a 26.6 fixed point pen position of the active glyph caches to the requested point size.
+ * 
+ * @param position	The position in 26.6 fixed point pixels of the active glyph caches.
+ * @return The position in 26.6 fixed point pixels of the requested point size.
+ */
+int32_t FreeTypeGX::scalePosition(int32_t position) {
+	if(this->renderScale == 1.0f) {
+		return position;
+	}
+
+	return (int32_t)floorf(position * this->renderScale + 0.5f);
+}
+
+/**
+ * Snaps a 26.6 fixed point screen position to the subpixel phases of the active glyph caches.
+ * 
+ * This routine rounds the position to the nearest subpixel phase and splits it into the whole pixel to the left of the
+ * phase and the phase itself. Glyph caches without subpixel phases round the position to the nearest whole pixel.
+ * 
+ * @param position	The screen position in 26.6 fixed point pixels.
+ * @param phase	Output subpixel phase of the position, from zero to one less than the number of subpixel phases.
+ * @return The whole pixel screen position.
+ */
+int16_t FreeTypeGX::snapPosition(int32_t position, uint8_t *phase) {
+	int32_t phases = this->fontSize->subpixelPhases;
+
+	if(phases <= 1) {
+		*phase = 0;
+		return (position + 32) >> 6;
+	}
+
+	int32_t steps = (position * phases + 32) >> 6;
+	int32_t pixel = steps >= 0 ? steps / phases : -((phases - 1 - steps) / phases);
+
+	*phase = steps - pixel * phases;
+	return pixel;
+}
+
+/**
+ * Reserves a region of the texture atlas for a glyph texture.
+ * 
+ * This routine locates space for a texture of the given dimensions using a simple shelf packing scheme. Each page is
+ * divided into horizontal shelves and the glyph is placed on the first shelf which is tall enough and has sufficient
+ * remaining width. If no such shelf exists a new shelf is opened or, failing that, a new page is allocated. Textures
+ * larger than FTGX_TEXTURE_PAGE_SIZE receive a dedicated page of their own.
+ * 
+ * @param width	The tile aligned width of the texture in pixels.
+ * @param height	The tile aligned height of the texture in pixels.
+ * @param x	Output X coordinate of the reserved region in pixels.
+ * @param y	Output Y coordinate of the reserved region in pixels.
+ * @return The index of the page containing the reserved region.
+ */
+uint16_t FreeTypeGX::allocateTextureRegion(uint16_t width, uint16_t height, uint16_t *x, uint16_t *y) {
+	uint16_t pageIndex;
+
+	for(pageIndex = 0; pageIndex < this->fontSize->texturePages.size(); pageIndex++) {
+		ftgxTexturePage *page = &this->fontSize->texturePages[pageIndex];
+
+		if(width > page->pageWidth) {
+			continue;
+		}
+
+		for(std::vector<ftgxTextureShelf>::iterator shelf = page->shelves.begin(); shelf != page->shelves.end(); shelf++) {
+			if(shelf->shelfHeight >= height && page->pageWidth - shelf->shelfUsed >= width) {
+				*x = shelf->shelfUsed;
+				*y = shelf->shelfY;
+				shelf->shelfUsed += width;
+				return pageIndex;
+			}
+		}
+
+		if(page->pageHeight - page->pageUsed >= height) {
+			page->shelves.push_back((ftgxTextureShelf){page->pageUsed, height, width});
+			*x = 0;
+			*y = page->pageUsed;
+			page->pageUsed += height;
+			return pageIndex;
+		}
+	}
+
+	ftgxTexturePage newPage;
+	newPage.pageWidth = adjustTextureWidth(width > FTGX_TEXTURE_PAGE_SIZE ? width : FTGX_TEXTURE_PAGE_SIZE, this->textureFormat);
+	newPage.pageHeight = adjustTextureHeight(height > FTGX_TEXTURE_PAGE_SIZE ? height : FTGX_TEXTURE_PAGE_SIZE, this->textureFormat);
+	newPage.pageUsed = height;
+	newPage.shelves.push_back((ftgxTextureShelf){0, height, width});
+
+	uint32_t pageSize = getTextureSize(newPage.pageWidth, newPage.pageHeight, this->textureFormat);
+	newPage.pageDataTexture = (uint32_t *)memalign(32, pageSize);
+	newPage.pageDataOwned = true;
+	memset(newPage.pageDataTexture, 0x00, pageSize);
+	DCFlushRange(newPage.pageDataTexture, pageSize);
+	this->gxTexCacheDirty = true;
+
+	GX_InitTexObj(&newPage.pageTexture, newPage.pageDataTexture, newPage.pageWidth, newPage.pageHeight, this->textureFormat, GX_CLAMP, GX_CLAMP, GX_FALSE);
+	this->fontSize->texturePages.push_back(newPage);
+
+	*x = 0;
+	*y = 0;
+	return pageIndex;
+}
+
+/**
+ * Copies a converted glyph texture into its reserved texture atlas region.
+ * 
+ * This routine copies the tiles of the converted glyph texture into the tile rows of the atlas page and calculates the
+ * texture coordinates of the glyph within the page. As both the glyph and the region are tile aligned each tile row can be
+ * copied as a single contiguous block.
+ * 
+ * @param glyphTexture	The glyph texture data in the target texture format.
+ * @param charTexture	A pointer to the ftgxCharTexture structure of the glyph with the texturePage member set.
+ * @param x	X coordinate of the reserved region in pixels.
+ * @param y	Y coordinate of the reserved region in pixels.
+ */
+void FreeTypeGX::copyTextureToPage(uint32_t *glyphTexture, ftgxCharTexture *charTexture, uint16_t x, uint16_t y) {
+	ftgxTexturePage *page = &this->fontSize->texturePages[charTexture->texturePage];
+
+	uint16_t tileWidth = adjustTextureWidth(1, this->textureFormat);
+	uint16_t tileHeight = adjustTextureHeight(1, this->textureFormat);
+	uint32_t tileSize = getTextureSize(tileWidth, tileHeight, this->textureFormat);
+
+	uint32_t rowSize = (charTexture->textureWidth / tileWidth) * tileSize;
+	uint32_t pageRowSize = (page->pageWidth / tileWidth) * tileSize;
+
+	uint8_t *src = (uint8_t *)glyphTexture;
+	uint8_t *dest = (uint8_t *)page->pageDataTexture + (y / tileHeight) * pageRowSize + (x / tileWidth) * tileSize;
+
+	for (uint16_t tileRow = 0; tileRow < charTexture->textureHeight / tileHeight; tileRow++) {
+		memcpy(dest, src, rowSize);
+		DCFlushRange(dest, rowSize);
+
+		src += rowSize;
+		dest += pageRowSize;
+	}
+	this->gxTexCacheDirty = true;
+
+	charTexture->textureCoordLeft = (f32)x / page->pageWidth;
+	charTexture->textureCoordTop = (f32)y / page->pageHeight;
+	charTexture->textureCoordRight = (f32)(x + charTexture->textureWidth) / page->pageWidth;
+	charTexture->textureCoordBottom = (f32)(y + charTexture->textureHeight) / page->pageHeight;
+
+	std::vector<ftgxCharTexture> &glyphTextures = this->fontSize->glyphTextures;
+	if(this->fontSize->texCoordArray != NULL && charTexture >= &glyphTextures[0] && charTexture < &glyphTextures[0] + glyphTextures.size()) {
+		this->storeTexCoords(this->fontSize, charTexture - &glyphTextures[0]);
+	}
+}
+
+/**
+ * Determines the x offset of the rendered string.
+ * 
+ * This routine calculates the x offset of the rendered string based off of a supplied positional format parameter.
+ * 
+ * @param width	Current pixel width of the string.
+ * @param format	Positional format of the string.
+ */
+uint16_t FreeTypeGX::getStyleOffsetWidth(uint16_t width, uint16_t format) {
+	switch(format & FTGX_JUSTIFY_MASK) {
+		case FTGX_JUSTIFY_LEFT:
+			return 0;
+		case FTGX_JUSTIFY_CENTER:
+			return width >> 1;
+		case FTGX_JUSTIFY_RIGHT:
+			return width;
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Determines the y offset of the rendered string.
+ * 
+ * This routine calculates the y offset of the rendered string based off of a supplied positional format parameter.
+ * 
+ * @param format	Positional format of the string.
+ */
+uint16_t FreeTypeGX::getStyleOffsetHeight(uint16_t format) {
+	switch(format & FTGX_ALIGN_MASK) {
+		case FTGX_ALIGN_TOP:
+			return -this->scaleMetric(this->fontSize->ascender);
+		case FTGX_ALIGN_MIDDLE:
+			return -this->scaleMetric(this->fontSize->descender + this->fontSize->ascender) >> 1;
+		case FTGX_ALIGN_BOTTOM:
+			return this->scaleMetric(this->fontSize->descender);
+		default:
+			return 0;
+	}
+}
+
+/**
+ * Returns the FreeTypeGX font character data structure.
+ *
+ * This routine locates the currently cached FreeTypeGX ftgxCharData structure for the supplied wide character. If the
+ * structure has not been loaded and cached the routine initialized the loading and caching of the structure for that
+ * data chatracter.
+ *
+ * @param character	Character whose information needs to be retrieved.
+ * @return The font structure for the supplied character.
+ */
+ftgxCharData* FreeTypeGX::getCharacter(wchar_t character) {
+	uint16_t glyphSlot = this->findGlyphSlot(character);
+	if(glyphSlot == FTGX_GLYPH_MISSING) {
+		return this->getReplacementGlyph();
+	}
+	if(glyphSlot) {
+		return &this->fontSize->glyphMetrics[glyphSlot - 1];
+	}
+
+	return this->cacheGlyphData(character);
+}
+
+/**
+ * Returns the FreeTypeGX font character data structure of the replacement character.
+ *
+ * This routine locates the glyph used in place of characters unsupported by the font as configured by
+ * setReplacementCharacter. The replacement glyph is resolved and cached the first time it is required.
+ *
+ * @return The font structure for the replacement character, or NULL if unsupported characters should be skipped.
+ */
+ftgxCharData* FreeTypeGX::getReplacementGlyph() {
+	if(this->fontSize->replacementSlot == 0) {
+		if(this->replacementCharacter == FTGX_REPLACEMENT_NONE) {
+			this->fontSize->replacementSlot = FTGX_GLYPH_MISSING;
+		}
+		else if(this->replacementCharacter == FTGX_REPLACEMENT_NOTDEF) {
+			if(this->fontSize->notdefSlot == 0) {
+				this->fontSize->notdefSlot = this->cacheGlyphIndex(0);
+			}
+			this->fontSize->replacementSlot = this->fontSize->notdefSlot;
+		}
+		else {
+			uint16_t glyphSlot = this->findGlyphSlot(this->replacementCharacter);
+			uint16_t *glyphSlotEntry;
+
+			if(glyphSlot == 0 && (glyphSlotEntry = this->allocateGlyphSlot(this->replacementCharacter)) != NULL) {
+				FT_UInt gIndex = this->ftFace != NULL ? FT_Get_Char_Index(this->ftFace, this->replacementCharacter) : 0;
+				glyphSlot = *glyphSlotEntry = gIndex != 0 ? this->cacheGlyphIndex(gIndex) : FTGX_GLYPH_MISSING;
+			}
+			this->fontSize->replacementSlot = glyphSlot != 0 ? glyphSlot : FTGX_GLYPH_MISSING;
+		}
+	}
+
+	return this->fontSize->replacementSlot != FTGX_GLYPH_MISSING ? &this->fontSize->glyphMetrics[this->fontSize->replacementSlot - 1] : NULL;
+}
+
+/**
+ * Returns the glyph slot of the solid texture sampled by text feature quads.
+ *
+ * This routine reserves a glyph slot which no character maps to the first time it is called for the active point size and
+ * loads a fully opaque texture of a single tile into the texture atlas for it. The texture coordinates of the slot all lie
+ * at the center of the tile, so that text features sample a solid texel regardless of the texture filter and can be drawn
+ * with the same vertex format and TEV operation as the glyphs.
+ *
+ * @return The glyph slot of the solid texture, or zero if no glyph slot is available.
+ */
+uint16_t FreeTypeGX::getSolidSlot() {
+	if(this->fontSize->solidSlot != 0 || this->fontSize->glyphMetrics.size() >= FTGX_GLYPH_MISSING - 1) {
+		return this->fontSize->solidSlot;
+	}
+
+	ftgxCharTexture solidTexture = {
+		adjustTextureWidth(1, this->textureFormat),
+		adjustTextureHeight(1, this->textureFormat),
+		0, 0.0f, 0.0f, 0.0f, 0.0f
+	};
+
+	FT_Bitmap solidBitmap;
+	memset(&solidBitmap, 0x00, sizeof(FT_Bitmap));
+	solidBitmap.width = solidTexture.textureWidth;
+	solidBitmap.rows = solidTexture.textureHeight;
+	solidBitmap.pitch = solidBitmap.width;
+	solidBitmap.num_grays = 256;
+	solidBitmap.pixel_mode = FT_PIXEL_MODE_GRAY;
+	solidBitmap.buffer = (unsigned char *)memalign(32, solidBitmap.width * solidBitmap.rows);
+	memset(solidBitmap.buffer, 0xff, solidBitmap.width * solidBitmap.rows);
+
+	this->fontSize->glyphMetrics.push_back((ftgxCharData){ 0, 0, 0, 0, 0 });
+	this->fontSize->glyphTextures.push_back(solidTexture);
+
+	ftgxCharTexture *charTexture = &this->fontSize->glyphTextures.back();
+	this->loadGlyphData(&solidBitmap, charTexture);
+	free(solidBitmap.buffer);
+
+	charTexture->textureCoordLeft = charTexture->textureCoordRight = (charTexture->textureCoordLeft + charTexture->textureCoordRight) * 0.5f;
+	charTexture->textureCoordTop = charTexture->textureCoordBottom = (charTexture->textureCoordTop + charTexture->textureCoordBottom) * 0.5f;
+
+	this->fontSize->solidSlot = this->fontSize->glyphMetrics.size();
+	if(this->fontSize->texCoordArray != NULL) {
+		this->storeTexCoords(this->fontSize, this->fontSize->solidSlot - 1);
+	}
+
+	return this->fontSize->solidSlot;
+}
+
+/**
+ * Returns the FreeTypeGX font character texture data structure.
+ *
+ * This routine locates the ftgxCharTexture structure which shares the glyph slot of the supplied metrics structure. If the
+ * glyph texture has not yet been rendered the routine initializes the rendering and loading of the texture. Note that this
+ * may update the render offsets of the supplied metrics structure.
+ *
+ * @param charData	Font structure previously returned by getCharacter.
+ * @return The texture structure for the supplied character.
+ */
+ftgxCharTexture* FreeTypeGX::getCharacterTexture(ftgxCharData *charData) {
+	ftgxCharTexture *charTexture = &this->fontSize->glyphTextures[charData - &this->fontSize->glyphMetrics[0]];
+
+	if(charTexture->texturePage == FTGX_TEXTURE_PENDING) {
+		if(this->asyncCachingEnabled && this->fontSize->texturePadding == 0 && this->fontSize->subpixelPhases == 1 && this->queueGlyphTexture(charData)) {
+			charTexture->texturePage = FTGX_TEXTURE_QUEUED;
+		}
+		else {
+			this->cacheGlyphTexture(charData, charTexture);
+		}
+	}
+
+	return charTexture;
+}
+
+/**
+ * Returns the texture of a glyph rendered at a subpixel phase.
+ *
+ * This routine locates the phase variant of the supplied glyph texture, rendering and loading it into the texture atlas
+ * if it has not been rendered yet. Phase variants are held apart from the glyph textures so that the glyph slots and the
+ * texture coordinate array are unaffected by them.
+ *
+ * @param charData	A pointer to the ftgxCharData structure of the glyph.
+ * @param charTexture	A pointer to the rendered ftgxCharTexture structure of the glyph.
+ * @param phase	The subpixel phase, from one to one less than the number of subpixel phases.
+ * @return The texture structure of the glyph at the supplied phase.
+ */
+ftgxCharTexture* FreeTypeGX::getPhaseTexture(ftgxCharData *charData, ftgxCharTexture *charTexture, uint8_t phase) {
+	std::vector<ftgxCharTexture> &phaseTextures = this->fontSize->phaseTextures;
+	uint8_t phaseCount = this->fontSize->subpixelPhases - 1;
+	uint32_t phaseIndex = (charTexture - &this->fontSize->glyphTextures[0]) * phaseCount + phase - 1;
+
+	if(phaseIndex >= phaseTextures.size()) {
+		phaseTextures.resize(this->fontSize->glyphTextures.size() * phaseCount, (ftgxCharTexture){ 0, 0, FTGX_TEXTURE_PENDING, 0.0f, 0.0f, 0.0f, 0.0f });
+	}
+
+	ftgxCharTexture *phaseTexture = &phaseTextures[phaseIndex];
+	if(phaseTexture->texturePage == FTGX_TEXTURE_PENDING) {
+		this->cachePhaseTexture(charData, charTexture, phaseTexture, phase);
+	}
+
+	return phaseTexture;
+}
+
+/**
+ * Renders the texture of a glyph at a subpixel phase.
+ *
+ * This routine renders the outline of the glyph shifted right by the fraction of a pixel of the supplied phase into a
+ * bitmap one pixel wider than the glyph texture and loads it into the texture atlas. The bitmap shares the rows and top
+ * bearing of the whole pixel glyph texture so that both are drawn at the same height. Glyphs without an outline, and all
+ * glyphs once the phase variants of the point size hold FTGX_SUBPIXEL_MEMORY_LIMIT bytes of textures, share the whole
+ * pixel glyph texture instead.
+ *
+ * @param charData	A pointer to the ftgxCharData structure of the glyph.
+ * @param charTexture	A pointer to the rendered ftgxCharTexture structure of the glyph.
+ * @param phaseTexture	A pointer to the ftgxCharTexture structure receiving the phase variant.
+ * @param phase	The subpixel phase, from one to one less than the number of subpixel phases.
+ */
+void FreeTypeGX::cachePhaseTexture(ftgxCharData *charData, ftgxCharTexture *charTexture, ftgxCharTexture *phaseTexture, uint8_t phase) {
+	*phaseTexture = *charTexture;
+
+	uint16_t textureWidth = adjustTextureWidth(charTexture->textureWidth + 1, this->textureFormat);
+	uint32_t textureSize = getTextureSize(textureWidth, charTexture->textureHeight, this->textureFormat);
+	if(this->fontSize->phaseTextureSize + textureSize > FTGX_SUBPIXEL_MEMORY_LIMIT) {
+		return;
+	}
+
+	if((this->ftLoadedGlyph != charData->glyphIndex || this->ftFace->glyph->format != FT_GLYPH_FORMAT_OUTLINE) && !this->loadGlyph(charData->glyphIndex)) {
+		return;
+	}
+	if(this->ftFace->glyph->format != FT_GLYPH_FORMAT_OUTLINE) {
+		return;
+	}
+
+	FT_Outline *outline = &this->ftFace->glyph->outline;
+	FT_BBox outlineBox;
+	FT_Outline_Get_CBox(outline, &outlineBox);
+
+	/* The bitmap spans the columns of the phase texture and the rows of the whole pixel texture */
+	FT_Pos left = outlineBox.xMin & -64, bottom = ((int16_t)charData->renderOffsetY - charTexture->textureHeight) << 6;
+	FT_Pos shiftX = (phase << 6) / this->fontSize->subpixelPhases - left;
+
+	FT_Bitmap phaseBitmap;
+	memset(&phaseBitmap, 0x00, sizeof(FT_Bitmap));
+	phaseBitmap.width = textureWidth;
+	phaseBitmap.rows = charTexture->textureHeight;
+	phaseBitmap.pitch = phaseBitmap.width;
+	phaseBitmap.num_grays = 256;
+	phaseBitmap.pixel_mode = FT_PIXEL_MODE_GRAY;
+	phaseBitmap.buffer = (unsigned char *)memalign(32, phaseBitmap.width * phaseBitmap.rows);
+	if(phaseBitmap.buffer == NULL) {
+		return;
+	}
+	memset(phaseBitmap.buffer, 0x00, phaseBitmap.width * phaseBitmap.rows);
+
+	FT_Outline_Translate(outline, shiftX, -bottom);
+	bool rendered = !FT_Outline_Get_Bitmap(this->ftLibrary, outline, &phaseBitmap);
+	FT_Outline_Translate(outline, -shiftX, bottom);
+
+	if(rendered) {
+		phaseTexture->textureWidth = textureWidth;
+		this->loadGlyphData(&phaseBitmap, phaseTexture);
+		this->fontSize->phaseTextureSize += textureSize;
+	}
+
+	free(phaseBitmap.buffer);
+}
+
+/**
+ * Processes the supplied text string and prints the results at the specified coordinates.
+ * 
+ * This routine processes each character of the supplied text string, loads the relevant preprocessed bitmap buffer,
+ * a texture from said buffer, and loads the resultant texture into the EFB.
+ * 
+ * @param x	Screen X coordinate at which to output the text.
+ * @param y Screen Y coordinate at which to output the text. Note that this value corresponds to the text string origin and not the top or bottom of the glyphs.
+ * @param text	NULL terminated string to output.
+ * @param color	Optional color to apply to the text characters. If not specified default value is ftgxWhite: (GXColor){0xff, 0xff, 0xff, 0xff}
+ * @param textStyle	Flags which specify any styling which should be applied to the rendered string.
+ * @return The number of characters printed.
+ */
+uint16_t FreeTypeGX::drawText(int16_t x, int16_t y, wchar_t *text, GXColor color, uint16_t textStyle) {
+	return this->drawCharacters(x, y, wideTextReader(text), color, textStyle);
+}
+
+/**
+ * \overload
+ */
+uint16_t FreeTypeGX::drawText(int16_t x, int16_t y, wchar_t const *text, GXColor color, uint16_t textStyle) {
+	return this->drawText(x, y, (wchar_t *)text, color, textStyle);
+}
+
+/**
+ * Processes the supplied UTF-8 text string and prints the results at the specified coordinates.
+ * 
+ * This routine decodes the characters of the supplied text string in place as its glyphs are laid out, so that neither
+ * a wide character copy of the text nor any other memory is allocated. Invalid byte sequences are drawn as U+FFFD. The
+ * width of justified or styled UTF-8 text is measured without the text width cache.
+ * 
+ * @param x	Screen X coordinate at which to output the text.
+ * @param y Screen Y coordinate at which to output the text. Note that this value corresponds to the text string origin and not the top or bottom of the glyphs.
+ * @param text	UTF-8 string to output.
+ * @param color	Optional color to apply to the text characters. If not specified default value is ftgxWhite: (GXColor){0xff, 0xff, 0xff, 0xff}
+ * @param textStyle	Flags which specify any styling which should be applied to the rendered string.
+ * @param length	Optional length of the string in bytes. If not specified default value is FTGX_TEXT_TERMINATED for a NULL terminated string.
+ * @return The number of characters printed.
+ */
+uint16_t FreeTypeGX::drawText(int16_t x, int16_t y, const char *text, GXColor color, uint16_t textStyle, uint32_t length) {
+	return this->drawCharacters(x, y, utf8TextReader(text, length), color, textStyle);
+}
+
+/**
+ * Lays out and draws the characters read from a text string.
+ * 
+ * @param x	Screen X coordinate at which to output the text.
+ * @param y	Screen Y coordinate of the text string origin.
+ * @param reader	Reader positioned at the start of the text string.
+ * @param color	Color to apply to the text characters.
+ * @param textStyle	Flags which specify any styling which should be applied to the rendered string.
+ * @return The number of characters printed.
+ */
+uint16_t FreeTypeGX::drawCharacters(int16_t x, int16_t y, ftgxTextReader reader, GXColor color, uint16_t textStyle) {
+	uint16_t x_offset = 0, y_offset = 0;
+	uint16_t textWidth = 0;
+
+	if(this->fontSize == NULL) {
+		return 0;
+	}
+
+	if(this->asyncThreadRunning) {
+		this->publishAsyncGlyphs();
+	}
+
+	if(this->isTextClipped(x, y, textStyle)) {
+		return 0;
+	}
+
+	this->resetState();
+	this->getStyleOffsets(reader, textStyle, &textWidth, &x_offset, &y_offset);
+
+	uint16_t printed = this->batchGlyphs(x - x_offset, y - y_offset, reader, color, maxVideoWidth, false, this->clipEnabled);
+
+	if(textStyle & FTGX_STYLE_MASK) {
+		this->batchTextFeature(x - x_offset, y - y_offset, textWidth, textStyle, color, this->clipEnabled);
+	}
+
+	this->submitGlyphBatch(color);
+
+	return printed;
+}
+
+/**
+ * Formats text into a stack buffer and prints it at the specified coordinates.
+ * 
+ * This routine formats the supplied printf style format string and arguments into a buffer of FTGX_FORMAT_BUFFER_SIZE
+ * bytes on the stack and draws the result as UTF-8 text, so that frequently changing text such as counters never
+ * allocates memory nor fills the text width cache. Formatted text longer than the buffer is truncated.
+ * 
+ * @param x	Screen X coordinate at which to output the text.
+ * @param y Screen Y coordinate at which to output the text. Note that this value corresponds to the text string origin and not the top or bottom of the glyphs.
+ * @param color	Color to apply to the text characters.
+ * @param textStyle	Flags which specify any styling which should be applied to the rendered string.
+ * @param format	UTF-8 printf style format string.
+ * @return The number of characters printed.
+ */
+uint16_t FreeTypeGX::drawTextf(int16_t x, int16_t y, GXColor color, uint16_t textStyle, const char *format, ...) {
+	char buffer[FTGX_FORMAT_BUFFER_SIZE];
+	va_list arguments;
+
+	va_start(arguments, format);
+	int length = vsnprintf(buffer, sizeof(buffer), format, arguments);
+	va_end(arguments);
+
+	if(length < 0) {
+		return 0;
+	}
+
+	return this->drawCharacters(x, y, utf8TextReader(buffer, std::min<uint32_t>(length, sizeof(buffer) - 1)), color, textStyle);
+}
+
+/**
+ * Prints an integer at the specified coordinates.
+ * 
+ * This routine formats the integer into a small buffer on the stack and draws its digits from glyph slots resolved once
+ * per point size, so that counters redrawn every frame neither allocate memory, look up glyphs nor measure the text.
+ * 
+ * @param x	Screen X coordinate at which to output the number.
+ * @param y Screen Y coordinate at which to output the number. Note that this value corresponds to the text string origin and not the top or bottom of the glyphs.
+ * @param value	The integer to print.
+ * @param color	Optional color to apply to the digits. If not specified default value is ftgxWhite: (GXColor){0xff, 0xff, 0xff, 0xff}
+ * @param textStyle	Flags which specify any styling which should be applied to the rendered number.
+ * @param minDigits	Optional minimum number of digits, padded with leading zeros. If not specified default value is 1.
+ * @return The number of characters printed.
+ */
+uint16_t FreeTypeGX::drawNumber(int16_t x, int16_t y, int32_t value, GXColor color, uint16_t textStyle, uint8_t minDigits) {
+	char buffer[FTGX_NUMBER_BUFFER_SIZE];
+	char *bufferEnd = buffer + FTGX_NUMBER_BUFFER_SIZE;
+	uint32_t magnitude = value < 0 ? -(uint32_t)value : (uint32_t)value;
+
+	char *text = bufferEnd - formatDigits(bufferEnd, magnitude, std::min<uint8_t>(minDigits, FTGX_NUMBER_BUFFER_SIZE - 1));
+	if(value < 0) {
+		*--text = '-';
+	}
+
+	return this->drawNumberCharacters(x, y, text, bufferEnd - text, color, textStyle);
+}
+
+/**
+ * Prints a fixed point number at the specified coordinates.
+ * 
+ * This routine prints the fixed point number rounded to the requested number of decimals in the same manner as
+ * drawNumber, for instance to print timers or frame rates without converting them to floating point.
+ * 
+ * @param x	Screen X coordinate at which to output the number.
+ * @param y Screen Y coordinate at which to output the number. Note that this value corresponds to the text string origin and not the top or bottom of the glyphs.
+ * @param value	The fixed point number to print.
+ * @param fractionBits	Number of fractional bits of the fixed point number, at most 30.
+ * @param decimals	Number of decimals to print, at most 9.
+ * @param color	Optional color to apply to the digits. If not specified default value is ftgxWhite: (GXColor){0xff, 0xff, 0xff, 0xff}
+ * @param textStyle	Flags which specify any styling which should be applied to the rendered number.
+ * @return The number of characters printed.
+ */
+uint16_t FreeTypeGX::drawFixed(int16_t x, int16_t y, int32_t value, uint8_t fractionBits, uint8_t decimals, GXColor color, uint16_t textStyle) {
+	char buffer[FTGX_NUMBER_BUFFER_SIZE];
+	char *bufferEnd = buffer + FTGX_NUMBER_BUFFER_SIZE, *text = bufferEnd;
+	uint32_t magnitude = value < 0 ? -(uint32_t)value : (uint32_t)value;
+	uint32_t decimalScale = 1;
+
+	fractionBits = std::min<uint8_t>(fractionBits, 30);
+	decimals = std::min<uint8_t>(decimals, 9);
+	for(uint8_t i = 0; i < decimals; i++) {
+		decimalScale *= 10;
+	}
+
+	uint32_t integerPart = magnitude >> fractionBits;
+	uint32_t decimalPart = 0;
+	if(fractionBits > 0) {
+		uint64_t fraction = magnitude & ((1u << fractionBits) - 1);
+		decimalPart = (fraction * decimalScale + (1u << (fractionBits - 1))) >> fractionBits;
+	}
+	if(decimalPart >= decimalScale) {
+		decimalPart -= decimalScale;
+		integerPart++;
+	}
+
+	if(decimals > 0) {
+		text -= formatDigits(text, decimalPart, decimals);
+		*--text = '.';
+	}
+	text -= formatDigits(text, integerPart, 1);
+	if(value < 0 && (integerPart != 0 || decimalPart != 0)) {
+		*--text = '-';
+	}
+
+	return this->drawNumberCharacters(x, y, text, bufferEnd - text, color, textStyle);
+}
+
+/**
+ * Lays out and draws a number formatted by drawNumber or drawFixed.
+ * 
+ * This routine draws the digits, minus sign and decimal point of the number from the number glyph slots of the active
+ * point size. The width needed for justification is accumulated while the glyphs are positioned, and when the font has
+ * tabular figures no kerning is queried between digits.
+ * 
+ * @param x	Screen X coordinate at which to output the number.
+ * @param y	Screen Y coordinate of the number origin.
+ * @param text	The characters of the number.
+ * @param length	Number of characters, at most FTGX_NUMBER_BUFFER_SIZE.
+ * @param color	Color to apply to the characters.
+ * @param textStyle	Flags which specify any styling which should be applied to the rendered number.
+ * @return The number of characters printed.
+ */
+uint16_t FreeTypeGX::drawNumberCharacters(int16_t x, int16_t y, const char *text, uint8_t length, GXColor color, uint16_t textStyle) {
+	uint16_t glyphSlots[FTGX_NUMBER_BUFFER_SIZE];
+	int32_t glyphPens[FTGX_NUMBER_BUFFER_SIZE];
+	uint8_t glyphCount = 0;
+	int32_t pen = 0;
+	uint16_t previousIndex = 0;
+	bool previousDigit = false;
+
+	if(this->fontSize == NULL) {
+		return 0;
+	}
+
+	if(this->asyncThreadRunning) {
+		this->publishAsyncGlyphs();
+	}
+
+	if(this->isTextClipped(x, y, textStyle)) {
+		return 0;
+	}
+
+	if(!this->fontSize->numberSlotsResolved) {
+		this->resolveNumberGlyphs();
+	}
+
+	for(uint8_t i = 0; i < length; i++) {
+		bool digit = text[i] >= '0' && text[i] <= '9';
+		uint16_t glyphSlot = this->fontSize->numberSlots[digit ? text[i] - '0' : (text[i] == '-' ? 10 : 11)];
+
+		if(glyphSlot == 0) {
+			continue;
+		}
+
+		ftgxCharData *glyphData = &this->fontSize->glyphMetrics[glyphSlot - 1];
+		if(this->ftKerningEnabled && previousIndex && !(digit && previousDigit && this->fontSize->tabularDigits)) {
+			pen += this->getKerning(previousIndex, glyphData->glyphIndex);
+		}
+
+		glyphSlots[glyphCount] = glyphSlot;
+		glyphPens[glyphCount++] = pen;
+
+		pen += glyphData->glyphAdvanceX;
+		previousIndex = glyphData->glyphIndex;
+		previousDigit = digit;
+	}
+
+	uint16_t textWidth = (this->scalePosition(pen) + 32) >> 6;
+	int16_t x_offset = (textStyle & FTGX_JUSTIFY_MASK) ? this->getStyleOffsetWidth(textWidth, textStyle) : 0;
+	int16_t y_offset = (textStyle & FTGX_ALIGN_MASK) ? this->getStyleOffsetHeight(textStyle) : 0;
+
+	this->resetState();
+
+	int32_t origin = (x - x_offset) * 64;
+	for(uint8_t i = 0; i < glyphCount; i++) {
+		this->batchGlyph(&this->fontSize->glyphMetrics[glyphSlots[i] - 1], origin, glyphPens[i], y - y_offset, color, false, this->clipEnabled);
+	}
+
+	if(textStyle & FTGX_STYLE_MASK) {
+		this->batchTextFeature(x - x_offset, y - y_offset, textWidth, textStyle, color, this->clipEnabled);
+	}
+
+	this->submitGlyphBatch(color);
+
+	return glyphCount;
+}
+
+/**
+ * Resolves the number glyph slots of the active point size.
+ * 
+ * This routine looks up the glyphs of the digits, minus sign and decimal point once per point size and determines
+ * whether the font has tabular figures, that is whether all digits share a single advance width with no kerning
+ * between any pair of them.
+ */
+void FreeTypeGX::resolveNumberGlyphs() {
+	static const wchar_t numberCharacters[FTGX_NUMBER_GLYPHS] = { L'0', L'1', L'2', L'3', L'4', L'5', L'6', L'7', L'8', L'9', L'-', L'.' };
+	ftgxFontSize *size = this->fontSize;
+
+	for(uint8_t i = 0; i < FTGX_NUMBER_GLYPHS; i++) {
+		ftgxCharData *glyphData = this->getCharacter(numberCharacters[i]);
+		size->numberSlots[i] = glyphData != NULL ? glyphData - &size->glyphMetrics[0] + 1 : 0;
+	}
+
+	size->tabularDigits = true;
+	for(uint8_t left = 0; left < 10 && size->tabularDigits; left++) {
+		if(size->numberSlots[left] == 0 || size->glyphMetrics[size->numberSlots[left] - 1].glyphAdvanceX != size->glyphMetrics[size->numberSlots[0] - 1].glyphAdvanceX) {
+			size->tabularDigits = false;
+			break;
+		}
+
+		for(uint8_t right = 0; right < 10; right++) {
+			if(size->numberSlots[right] != 0 && this->getKerning(size->glyphMetrics[size->numberSlots[left] - 1].glyphIndex, size->glyphMetrics[size->numberSlots[right] - 1].glyphIndex) != 0) {
+				size->tabularDigits = false;
+				break;
+			}
+		}
+	}
+
+	size->numberSlotsResolved = true;
+}
+
+/**
+ * Determines whether a single line of text lies wholly outside of the clip rectangle.
+ * 
+ * This routine rejects text whose line lies above or below the clip rectangle, or which starts past its right edge and is
+ * not justified towards the left, without looking up any of its glyphs.
+ * 
+ * @param x	Screen X coordinate of the text.
+ * @param y	Screen Y coordinate of the text.
+ * @param textStyle	Flags which specify any styling which should be applied to the rendered string.
+ * @return True if the text can be skipped.
+ */
+bool FreeTypeGX::isTextClipped(int16_t x, int16_t y, uint16_t textStyle) {
+	if(!this->clipEnabled) {
+		return false;
+	}
+
+	int16_t baseline = y - ((textStyle & FTGX_ALIGN_MASK) ? this->getStyleOffsetHeight(textStyle) : 0);
+
+	if(x >= this->clipRight && !(textStyle & (FTGX_JUSTIFY_CENTER | FTGX_JUSTIFY_RIGHT))) {
+		return true;
+	}
+
+	return baseline + this->scaleMetric(this->fontSize->extentBottom) <= this->clipTop || baseline - this->scaleMetric(this->fontSize->extentTop) >= this->clipBottom;
+}
+
+/**
+ * Draws text previously compiled with compileText.
+ * 
+ * This routine calls the display list of the compiled text with a position matrix translating it to the specified
+ * coordinates, so that no layout or glyph lookups take place. The text is compiled again first should its point size have
+ * been released, for instance by loading another font, or should the vertex format have changed since it was compiled.
+ * 
+ * @param x	Screen X coordinate at which to output the text.
+ * @param y Screen Y coordinate at which to output the text. Note that this value corresponds to the text string origin and not the top or bottom of the glyphs.
+ * @param handle	The compiled text.
+ * @return The number of characters printed.
+ */
+uint16_t FreeTypeGX::drawText(int16_t x, int16_t y, ftgxTextHandle *handle) {
+	if(handle == NULL) {
+		return 0;
+	}
+
+	if(this->asyncThreadRunning) {
+		this->publishAsyncGlyphs();
+	}
+
+	if(this->getTextHandleSize(handle) == NULL && !this->buildTextHandle(handle)) {
+		return 0;
+	}
+
+	this->resetState();
+
+	if(handle->displayList != NULL) {
+		Mtx positionMatrix;
+
+		if(handle->texCoordDesc != GX_DIRECT) {
+			this->setTexCoordArray(handle->texCoordArray, handle->compactVertices);
+		}
+		this->setGlyphMode(handle->textColor, handle->texCoordDesc, this->getTextHandleSize(handle)->texturePadding != 0);
+		if(this->gxTexCacheDirty) {
+			GX_InvalidateTexAll();
+			this->gxTexCacheDirty = false;
+		}
+
+		guMtxTrans(positionMatrix, x, y, 0.0f);
+		guMtxConcat(this->textViewMatrix, positionMatrix, positionMatrix);
+		GX_LoadPosMtxImm(positionMatrix, FTGX_TEXT_POSMTX);
+		GX_SetCurrentMtx(FTGX_TEXT_POSMTX);
+
+		GX_CallDispList(handle->displayList, handle->displayListSize);
+
+		GX_SetCurrentMtx(FTGX_DEFAULT_POSMTX);
+	}
+
+	this->setDefaultMode();
+
+	return handle->printed;
+}
+
+/**
+ * Draws text previously broken into lines with layoutText.
+ * 
+ * This routine draws the glyphs of each line at their stored positions, so that no measuring, kerning queries or line
+ * breaking take place. The text is laid out again first should the point size or kerning mode have changed since it was
+ * laid out. Lines above or below the clip rectangle are skipped.
+ * 
+ * @param x	Screen X coordinate at which to output the text.
+ * @param y Screen Y coordinate at which to output the text. Note that this value corresponds to the layout origin, which is the origin of the first line unless the layout is vertically aligned.
+ * @param layout	The text layout.
+ * @param color	Optional color to apply to the text characters. If not specified default value is ftgxWhite: (GXColor){0xff, 0xff, 0xff, 0xff}
+ * @return The number of characters printed.
+ */
+uint16_t FreeTypeGX::drawText(int16_t x, int16_t y, ftgxTextLayout *layout, GXColor color) {
+	uint16_t printed = 0;
+
+	if(layout == NULL || this->fontSize == NULL) {
+		return 0;
+	}
+
+	if(this->asyncThreadRunning) {
+		this->publishAsyncGlyphs();
+	}
+
+	if((layout->sizeSerial != this->fontSize->sizeSerial || layout->renderSize != this->renderSize || layout->kerningEnabled != this->ftKerningEnabled)
+		&& !this->buildTextLayout(layout)) {
+		return 0;
+	}
+
+	this->resetState();
+
+	for(std::vector<ftgxLayoutLine>::iterator line = layout->lines.begin(); line != layout->lines.end(); line++) {
+		int16_t baseline = y + line->lineY;
+
+		if(this->clipEnabled && (baseline + this->scaleMetric(this->fontSize->extentBottom) <= this->clipTop
+			|| baseline - this->scaleMetric(this->fontSize->extentTop) >= this->clipBottom)) {
+			continue;
+		}
+
+		int32_t origin = (x + line->lineX) * 64;
+		for(uint32_t i = line->glyphStart; i < line->glyphStart + line->glyphCount; i++) {
+			ftgxLayoutGlyph *glyph = &layout->glyphs[i];
+			this->batchGlyph(&this->fontSize->glyphMetrics[glyph->glyphSlot - 1], origin, glyph->penX, baseline, color, false, this->clipEnabled);
+		}
+		printed += line->glyphCount;
+
+		if(layout->textStyle & FTGX_STYLE_MASK) {
+			this->batchTextFeature(x + line->lineX, baseline, line->lineWidth, layout->textStyle, color, this->clipEnabled);
+		}
+	}
+
+	this->submitGlyphBatch(color);
+
+	return printed;
+}
+
+/**
+ * Draws text previously shaped with prepareText.
+ * 
+ * This routine streams the glyph quads of the prepared text from its resolved glyphs, so that no glyph lookups, kerning
+ * queries or width measurement take place. The text is prepared again first should the point size or kerning mode have
+ * changed since it was prepared. Text whose bounding box lies outside of the clip rectangle is rejected as a whole.
+ * 
+ * @param x	Screen X coordinate at which to output the text.
+ * @param y Screen Y coordinate at which to output the text. Note that this value corresponds to the text string origin and not the top or bottom of the glyphs.
+ * @param prepared	The prepared text.
+ * @param color	Optional color to apply to the text characters. If not specified default value is ftgxWhite: (GXColor){0xff, 0xff, 0xff, 0xff}
+ * @return The number of characters printed.
+ */
+uint16_t FreeTypeGX::drawText(int16_t x, int16_t y, ftgxPreparedText *prepared, GXColor color) {
+	if(prepared == NULL || this->fontSize == NULL) {
+		return 0;
+	}
+
+	if(this->asyncThreadRunning) {
+		this->publishAsyncGlyphs();
+	}
+
+	if((prepared->sizeSerial != this->fontSize->sizeSerial || prepared->renderSize != this->renderSize || prepared->kerningEnabled != this->ftKerningEnabled)
+		&& !this->buildPreparedText(prepared)) {
+		return 0;
+	}
+
+	if(this->clipEnabled && !(prepared->textStyle & FTGX_STYLE_MASK)) {
+		int16_t left = x + prepared->boundsLeft, top = y + prepared->boundsTop;
+
+		if(left + prepared->boundsWidth <= this->clipLeft || left >= this->clipRight || top + prepared->boundsHeight <= this->clipTop || top >= this->clipBottom) {
+			return 0;
+		}
+	}
+
+	this->resetState();
+
+	int32_t origin = (x + prepared->originX) * 64;
+	int16_t baseline = y + prepared->originY;
+	for(std::vector<ftgxPreparedGlyph>::iterator glyph = prepared->glyphs.begin(); glyph != prepared->glyphs.end(); glyph++) {
+		this->batchGlyph(&this->fontSize->glyphMetrics[glyph->glyphSlot - 1], origin, glyph->penX, baseline, color, false, this->clipEnabled);
+	}
+
+	if(prepared->textStyle & FTGX_STYLE_MASK) {
+		this->batchTextFeature(x + prepared->originX, baseline, prepared->textWidth, prepared->textStyle, color, this->clipEnabled);
+	}
+
+	this->submitGlyphBatch(color);
+
+	return prepared->glyphs.size();
+}
+
+/**
+ * Compiles the supplied text string into a GX display list.
+ * 
+ * This routine lays out the supplied text string with the active point size, styling and color in the same manner as
+ * drawText and records the resulting glyph quads into a display list so that the text can be drawn repeatedly with
+ * drawText at almost no processing cost. The text string is copied and need not remain valid. The returned handle must
+ * be released with releaseText.
+ * 
+ * @param text	NULL terminated string to compile.
+ * @param color	Optional color to apply to the text characters. If not specified default value is ftgxWhite: (GXColor){0xff, 0xff, 0xff, 0xff}
+ * @param textStyle	Flags which specify any styling which should be applied to the rendered string.
+ * @return The compiled text.
+ */
+ftgxTextHandle* FreeTypeGX::compileText(wchar_t *text, GXColor color, uint16_t textStyle) {
+	ftgxTextHandle *handle = new ftgxTextHandle();
+	uint32_t textLength = 0;
+
+	while(text[textLength]) {
+		textLength++;
 	}
-	
-	return numCached;
+
+	handle->text = new wchar_t[textLength + 1];
+	memcpy(handle->text, text, (textLength + 1) * sizeof(wchar_t));
+	handle->textColor = color;
+	handle->textStyle = textStyle;
+	handle->sizeSerial = 0;
+	handle->displayList = NULL;
+	handle->displayListSize = 0;
+
+	this->buildTextHandle(handle);
+
+	return handle;
 }
 
 /**
  * 
  * \overload
  */
-uint16_t FreeTypeGX::loadFont(const uint8_t* fontBuffer, FT_Long bufferSize, FT_UInt pointSize, bool cacheAll) {
-	return this->loadFont((uint8_t *)fontBuffer, bufferSize, pointSize, cacheAll);
+ftgxTextHandle* FreeTypeGX::compileText(wchar_t const *text, GXColor color, uint16_t textStyle) {
+	return this->compileText((wchar_t *)text, color, textStyle);
 }
 
 /**
- * Clears all loaded font glyph data.
+ * Releases text compiled with compileText.
  * 
- * This routine clears all members of the font map structure and frees all allocated memory back to the system.
+ * @param handle	The compiled text.
  */
-void FreeTypeGX::unloadFont() {
-	GX_DrawDone();
-	GX_Flush();
-	
-	for( std::map<wchar_t, ftgxCharData>::iterator i = this->fontData.begin(); i != this->fontData.end(); i++) {
-		free(i->second.glyphDataTexture);
-	}
-	if(this->ftFace) {
-		FT_Done_Face(this->ftFace);
+void FreeTypeGX::releaseText(ftgxTextHandle *handle) {
+	if(handle == NULL) {
+		return;
 	}
 
-	this->cacheTextWidth.clear();
-	this->fontData.clear();
+	free(handle->displayList);
+	delete[] handle->text;
+	delete handle;
 }
 
 /**
- * Enables or disables kerning of the output text.
- *
- * This routine enables or disables kerning of the output text only if kerning is supported by the font.
- * Note that by default kerning is enabled if it is supported by the font.
- *
- * @param enabled	The enabled state of the font kerning.
- * @return The resultant enabled state of the font kerning.
+ * Breaks the supplied text string into lines.
+ * 
+ * This routine measures the supplied text string once with the active point size and breaks it into lines at explicit
+ * newlines and, should a wrap width be given, at the last space before a line would exceed the wrap width. Words wider
+ * than the wrap width are broken between characters. Each line is justified individually with the FTGX_JUSTIFY_* flags
+ * of the styling while the FTGX_ALIGN_* flags align the block of lines as a whole. The resulting line spans and glyph
+ * positions may be inspected and the layout drawn repeatedly with drawText. The text string is copied and need not remain
+ * valid. The returned layout must be released with releaseLayout.
+ * 
+ * @param text	NULL terminated string to lay out.
+ * @param wrapWidth	Optional maximum pixel width of a line. If not specified default value is zero, which only breaks lines at newlines.
+ * @param textStyle	Flags which specify any styling which should be applied to the rendered string.
+ * @param lineSpacing	Optional pixel distance between the baselines of consecutive lines. If not specified default value is zero, which uses the line height of the font.
+ * @return The text layout.
  */
-bool FreeTypeGX::setKerningEnabled(bool enabled) {
-	if(!enabled) {
-		return this->ftKerningEnabled = false;
-	}
+ftgxTextLayout* FreeTypeGX::layoutText(wchar_t *text, uint16_t wrapWidth, uint16_t textStyle, uint16_t lineSpacing) {
+	ftgxTextLayout *layout = new ftgxTextLayout();
+	uint32_t textLength = 0;
 
-	if(FT_HAS_KERNING(this->ftFace)) {
-		return this->ftKerningEnabled = true;
+	while(text[textLength]) {
+		textLength++;
 	}
 
-	return false;
+	layout->text = new wchar_t[textLength + 1];
+	memcpy(layout->text, text, (textLength + 1) * sizeof(wchar_t));
+	layout->wrapWidth = wrapWidth;
+	layout->textStyle = textStyle;
+	layout->lineSpacing = lineSpacing;
+
+	this->buildTextLayout(layout);
+
+	return layout;
 }
 
 /**
- * Gets the current enabled state of the font kerning mode.
- *
- * This routine gets the current enabled state of the font kerning mode.
- *
- * @return The enabled state of the font kerning.
+ * 
+ * \overload
  */
-bool FreeTypeGX::getKerningEnabled() {
-	return this->ftKerningEnabled;
+ftgxTextLayout* FreeTypeGX::layoutText(wchar_t const *text, uint16_t wrapWidth, uint16_t textStyle, uint16_t lineSpacing) {
+	return this->layoutText((wchar_t *)text, wrapWidth, textStyle, lineSpacing);
 }
 
 /**
- * Enables or disables width value caching of the output text.
- *
- * This routine enables or disables width value caching of the output text in order avoid a repeated possible calculation of
- * textual width within the drawText function. If enabled FreeTypeGX will cache the values of all text strings drawn until such
- * time that clearTextWidthCache is called in order clear the current cache. Font width caching may be enabled or disabled at
- * any time by calling this function. Note that by default this option is disabled to conserve memory.
- *
- * @param enabled	The desired enabled state of the text width caching.
- * @return The resultant enabled state of the text width caching.
+ * Releases text laid out with layoutText.
+ * 
+ * @param layout	The text layout.
  */
-bool FreeTypeGX::setTextWidthCachingEnabled(bool enabled) {
-	return this->widthCachingEnabled = enabled;
+void FreeTypeGX::releaseLayout(ftgxTextLayout *layout) {
+	if(layout == NULL) {
+		return;
+	}
+
+	delete[] layout->text;
+	delete layout;
 }
 
 /**
- * Gets the current enabled state of the text width caching mode.
- *
- * This routine gets the current enabled state of the text width caching mode.
- *
- * @return The enabled state of the text width caching.
+ * Shapes the supplied text string for repeated drawing.
+ * 
+ * This routine resolves the glyphs, kerning and pen positions of the supplied text string with the active point size
+ * once and computes the offsets resulting from its styling and the bounding box of its glyphs, so that the prepared
+ * text can be drawn with drawText at any position and in any color by only streaming its glyph quads. Unlike compiled
+ * text prepared text is clipped and may be drawn deferred. The text string is copied and need not remain valid. The
+ * returned prepared text must be released with releasePreparedText.
+ * 
+ * @param text	NULL terminated string to prepare.
+ * @param textStyle	Flags which specify any styling which should be applied to the rendered string.
+ * @return The prepared text.
  */
-bool FreeTypeGX::getTextWidthCachingEnabled() {
-	return this->widthCachingEnabled;
+ftgxPreparedText* FreeTypeGX::prepareText(wchar_t *text, uint16_t textStyle) {
+	ftgxPreparedText *prepared = new ftgxPreparedText();
+	uint32_t textLength = 0;
+
+	while(text[textLength]) {
+		textLength++;
+	}
+
+	prepared->text = new wchar_t[textLength + 1];
+	memcpy(prepared->text, text, (textLength + 1) * sizeof(wchar_t));
+	prepared->textStyle = textStyle;
+
+	this->buildPreparedText(prepared);
+
+	return prepared;
 }
 
 /**
- * Clears the current cache of text widths.
- *
- * This clears the cache of text widths regardless of the enabled state of the width caching flag.
+ * 
+ * \overload
  */
-void FreeTypeGX::clearTextWidthCache() {
-	this->cacheTextWidth.clear();
+ftgxPreparedText* FreeTypeGX::prepareText(wchar_t const *text, uint16_t textStyle) {
+	return this->prepareText((wchar_t *)text, textStyle);
 }
 
 /**
- * Adjusts the texture data buffer to necessary width for a given texture format.
+ * Releases text prepared with prepareText.
  * 
- * This routine determines adjusts the given texture width into the required width to hold the necessary texture data for proper alignment.
+ * @param prepared	The prepared text.
+ */
+void FreeTypeGX::releasePreparedText(ftgxPreparedText *prepared) {
+	if(prepared == NULL) {
+		return;
+	}
+
+	delete[] prepared->text;
+	delete prepared;
+}
+
+/**
+ * Resolves the glyphs and pen positions of prepared text.
  * 
- * @param textureWidth	The initial guess for the texture width.
- * @param textureFormat	The texture format to which the data is to be converted.
- * @return The correctly adjusted texture width.
+ * This routine shapes the text of the prepared text with the active point size, replacing any previously resolved glyphs.
+ * The bounding box spans the texture extents of the glyphs excluding any distance field padding.
+ * 
+ * @param prepared	The prepared text.
+ * @return True if the text was prepared successfully.
  */
-uint16_t FreeTypeGX::adjustTextureWidth(uint16_t textureWidth, uint8_t textureFormat) {
-	uint16_t alignment;
-	
-	switch(textureFormat) {
-		case GX_TF_I4:		/* 8x8 Tiles - 4-bit Intensity */
-		case GX_TF_I8:		/* 8x4 Tiles - 8-bit Intensity */
-		case GX_TF_IA4:		/* 8x4 Tiles - 4-bit Intensity, , 4-bit Alpha */
-			alignment = 8;
-			break;
+bool FreeTypeGX::buildPreparedText(ftgxPreparedText *prepared) {
+	int32_t pen = 0;
+	uint16_t previousIndex = 0;
+	uint16_t padding;
+	int16_t boundsRight = 0, boundsBottom = 0;
+	bool hasBounds = false;
 
-		case GX_TF_IA8:		/* 4x4 Tiles - 8-bit Intensity, 8-bit Alpha */
-		case GX_TF_RGB565:	/* 4x4 Tiles - RGB565 Format */
-		case GX_TF_RGB5A3:	/* 4x4 Tiles - RGB5A3 Format */
-		case GX_TF_RGBA8:	/* 4x4 Tiles - RGBA8 Dual Cache Line Format */
-		default:
-			alignment = 4;
-			break;
+	prepared->glyphs.clear();
+	prepared->sizeSerial = 0;
+	prepared->textWidth = 0;
+	prepared->originX = 0;
+	prepared->originY = 0;
+	prepared->boundsLeft = 0;
+	prepared->boundsTop = 0;
+	prepared->boundsWidth = 0;
+	prepared->boundsHeight = 0;
+
+	if(this->fontSize == NULL) {
+		return false;
+	}
+
+	padding = this->fontSize->texturePadding;
+
+	for(uint32_t i = 0; prepared->text[i]; i++) {
+		ftgxCharData *glyphData = this->getCharacter(prepared->text[i]);
+
+		if(glyphData == NULL) {
+			continue;
+		}
+
+		if(this->ftKerningEnabled && previousIndex) {
+			pen += this->getKerning(previousIndex, glyphData->glyphIndex);
+		}
+
+		uint16_t glyphSlot = glyphData - &this->fontSize->glyphMetrics[0] + 1;
+		ftgxCharTexture *charTexture = &this->fontSize->glyphTextures[glyphSlot - 1];
+
+		if(charTexture->textureWidth > (padding << 1)) {
+			int16_t glyphLeft = (this->scalePosition(pen) + 32) >> 6;
+			int16_t glyphRight = (this->scalePosition(pen + ((charTexture->textureWidth - (padding << 1)) << 6)) + 32) >> 6;
+			int16_t glyphTop = -this->scaleMetric((int16_t)glyphData->renderOffsetMax);
+			int16_t glyphBottom = this->scaleMetric((int16_t)glyphData->renderOffsetMin);
+
+			if(!hasBounds) {
+				prepared->boundsLeft = glyphLeft;
+				prepared->boundsTop = glyphTop;
+				boundsRight = glyphRight;
+				boundsBottom = glyphBottom;
+				hasBounds = true;
+			}
+			else {
+				prepared->boundsLeft = std::min(prepared->boundsLeft, glyphLeft);
+				prepared->boundsTop = std::min(prepared->boundsTop, glyphTop);
+				boundsRight = std::max(boundsRight, glyphRight);
+				boundsBottom = std::max(boundsBottom, glyphBottom);
+			}
+		}
+
+		prepared->glyphs.push_back((ftgxPreparedGlyph){ glyphSlot, pen });
+		pen += glyphData->glyphAdvanceX;
+		previousIndex = glyphData->glyphIndex;
+	}
+
+	prepared->textWidth = (this->scalePosition(pen) + 32) >> 6;
+	if(prepared->textStyle & FTGX_JUSTIFY_MASK) {
+		prepared->originX = -(int16_t)this->getStyleOffsetWidth(prepared->textWidth, prepared->textStyle);
+	}
+	if(prepared->textStyle & FTGX_ALIGN_MASK) {
+		prepared->originY = -(int16_t)this->getStyleOffsetHeight(prepared->textStyle);
 	}
-	return textureWidth % alignment == 0 ? textureWidth : alignment + textureWidth - (textureWidth % alignment);
 
+	prepared->boundsWidth = boundsRight - prepared->boundsLeft;
+	prepared->boundsHeight = boundsBottom - prepared->boundsTop;
+	prepared->boundsLeft += prepared->originX;
+	prepared->boundsTop += prepared->originY;
+	prepared->sizeSerial = this->fontSize->sizeSerial;
+	prepared->renderSize = this->renderSize;
+	prepared->kerningEnabled = this->ftKerningEnabled;
+
+	return true;
 }
 
 /**
- * Adjusts the texture data buffer to necessary height for a given texture format.
+ * Computes the line spans and glyph positions of a text layout.
  * 
- * This routine determines adjusts the given texture height into the required height to hold the necessary texture data for proper alignment.
+ * This routine lays out the text of the layout with the active point size, replacing any previous lines and glyph
+ * positions. The pen of each line advances in 26.6 fixed point pixels of the glyph caches in the same manner as drawText
+ * so that laid out lines are drawn identically to single strings.
  * 
- * @param textureHeight	The initial guess for the texture height.
- * @param textureFormat	The texture format to which the data is to be converted.
- * @return The correctly adjusted texture height.
+ * @param layout	The text layout.
+ * @return True if the layout was computed successfully.
  */
-uint16_t FreeTypeGX::adjustTextureHeight(uint16_t textureHeight, uint8_t textureFormat) {
-	uint16_t alignment;
-	
-	switch(textureFormat) {
-		case GX_TF_I4:		/* 8x8 Tiles - 4-bit Intensity */
-			alignment = 8;
-			break;
+bool FreeTypeGX::buildTextLayout(ftgxTextLayout *layout) {
+	wchar_t *text = layout->text;
+	uint32_t i = 0;
+	bool moreLines = true;
 
-		case GX_TF_I8:		/* 8x4 Tiles - 8-bit Intensity */
-		case GX_TF_IA4:		/* 8x4 Tiles - 4-bit Intensity, , 4-bit Alpha */
-		case GX_TF_IA8:		/* 4x4 Tiles - 8-bit Intensity, 8-bit Alpha */
-		case GX_TF_RGB565:	/* 4x4 Tiles - RGB565 Format */
-		case GX_TF_RGB5A3:	/* 4x4 Tiles - RGB5A3 Format */
-		case GX_TF_RGBA8:	/* 4x4 Tiles - RGBA8 Dual Cache Line Format */
-		default:
-			alignment = 4;
+	layout->lines.clear();
+	layout->glyphs.clear();
+	layout->sizeSerial = 0;
+	layout->layoutWidth = 0;
+	layout->layoutHeight = 0;
+
+	if(this->fontSize == NULL) {
+		return false;
+	}
+
+	while(moreLines) {
+		ftgxLayoutLine line = { i, 0, (uint32_t)layout->glyphs.size(), 0, 0, 0, 0 };
+		uint32_t breakIndex = 0, breakGlyph = 0;
+		int32_t pen = 0, lineEnd = 0, breakEnd = 0;
+		uint16_t previousIndex = 0;
+		bool wrapped = false;
+
+		while(text[i] && text[i] != L'\n') {
+			ftgxCharData *glyphData = this->getCharacter(text[i]);
+
+			if(glyphData == NULL) {
+				i++;
+				continue;
+			}
+
+			if(this->ftKerningEnabled && previousIndex) {
+				pen += this->getKerning(previousIndex, glyphData->glyphIndex);
+			}
+
+			if(text[i] == L' ') {
+				/* Remember the first space following a word as the last opportunity to break the line */
+				if(i > line.textStart && text[i - 1] != L' ') {
+					breakIndex = i;
+					breakGlyph = layout->glyphs.size();
+					breakEnd = lineEnd;
+				}
+			}
+			else if(layout->wrapWidth && layout->glyphs.size() > line.glyphStart
+				&& (this->scalePosition(pen + glyphData->glyphAdvanceX) + 32) >> 6 > layout->wrapWidth) {
+				if(breakGlyph > line.glyphStart) {
+					layout->glyphs.resize(breakGlyph);
+					i = breakIndex;
+					lineEnd = breakEnd;
+				}
+				wrapped = true;
+				break;
+			}
+
+			layout->glyphs.push_back((ftgxLayoutGlyph){ (uint16_t)(glyphData - &this->fontSize->glyphMetrics[0] + 1), i, pen, 0, 0 });
+			pen += glyphData->glyphAdvanceX;
+			if(text[i] != L' ') {
+				lineEnd = pen;
+			}
+			previousIndex = glyphData->glyphIndex;
+			i++;
+		}
+
+		line.textLength = i - line.textStart;
+		line.glyphCount = layout->glyphs.size() - line.glyphStart;
+		line.lineWidth = (this->scalePosition(lineEnd) + 32) >> 6;
+		layout->lines.push_back(line);
+
+		if(wrapped) {
+			while(text[i] == L' ') {
+				i++;
+			}
+			moreLines = text[i] != 0;
+		}
+		else {
+			moreLines = text[i] == L'\n';
+			if(moreLines) {
+				i++;
+			}
+		}
+	}
+
+	int16_t lineHeight = layout->lineSpacing ? layout->lineSpacing : this->scaleMetric(this->fontSize->ascender - this->fontSize->descender);
+	int16_t blockY = -(int16_t)this->getStyleOffsetHeight(layout->textStyle);
+	int16_t linesHeight = (layout->lines.size() - 1) * lineHeight;
+
+	switch(layout->textStyle & FTGX_ALIGN_MASK) {
+		case FTGX_ALIGN_MIDDLE:
+			blockY -= linesHeight >> 1;
+			break;
+		case FTGX_ALIGN_BOTTOM:
+			blockY -= linesHeight;
 			break;
 	}
-	return textureHeight % alignment == 0 ? textureHeight : alignment + textureHeight - (textureHeight % alignment);
 
+	for(uint32_t lineIndex = 0; lineIndex < layout->lines.size(); lineIndex++) {
+		ftgxLayoutLine *line = &layout->lines[lineIndex];
+
+		line->lineX = -(int16_t)this->getStyleOffsetWidth(line->lineWidth, layout->textStyle);
+		line->lineY = blockY + lineIndex * lineHeight;
+
+		for(uint32_t glyphIndex = line->glyphStart; glyphIndex < line->glyphStart + line->glyphCount; glyphIndex++) {
+			ftgxLayoutGlyph *glyph = &layout->glyphs[glyphIndex];
+			glyph->positionX = line->lineX + ((this->scalePosition(glyph->penX) + 32) >> 6);
+			glyph->positionY = line->lineY;
+		}
+
+		layout->layoutWidth = std::max(layout->layoutWidth, line->lineWidth);
+	}
+
+	layout->layoutHeight = layout->lines.size() * lineHeight;
+	layout->sizeSerial = this->fontSize->sizeSerial;
+	layout->renderSize = this->renderSize;
+	layout->kerningEnabled = this->ftKerningEnabled;
+
+	return true;
 }
 
 /**
- * Caches the given font glyph in the instance font texture buffer.
- *
- * This routine renders and stores the requested glyph's bitmap and relevant information into its own quickly addressable
- * structure within an instance-specific map.
+ * Sets the clip rectangle applied to text.
  * 
- * @param charCode	The requested glyph's character code.
- * @return A pointer to the allocated font structure.
+ * Once set, glyphs which lie wholly outside of the clip rectangle are skipped and glyphs which lie partially outside of it
+ * are trimmed to its edges. Strings whose lines lie above or below the clip rectangle are rejected before any glyph is
+ * looked up, and processing of a string stops at the first glyph past its right edge, so that text scrolled out of view
+ * costs almost nothing. Compiled text is not clipped.
+ * 
+ * @param x	Screen X coordinate of the left edge of the clip rectangle.
+ * @param y	Screen Y coordinate of the top edge of the clip rectangle.
+ * @param width	Pixel width of the clip rectangle.
+ * @param height	Pixel height of the clip rectangle.
  */
-ftgxCharData *FreeTypeGX::cacheGlyphData(wchar_t charCode) {
-	FT_UInt gIndex;
-	uint16_t textureWidth = 0, textureHeight = 0;
+void FreeTypeGX::setClipRect(int16_t x, int16_t y, uint16_t width, uint16_t height) {
+	this->clipEnabled = true;
+	this->clipLeft = x;
+	this->clipTop = y;
+	this->clipRight = x + width;
+	this->clipBottom = y + height;
+}
+
+/**
+ * Removes the clip rectangle applied to text.
+ */
+void FreeTypeGX::clearClipRect() {
+	this->clipEnabled = false;
+}
 
-	gIndex = FT_Get_Char_Index( this->ftFace, charCode );
-	if (!FT_Load_Glyph(this->ftFace, gIndex, FT_LOAD_DEFAULT | FT_LOAD_RENDER)) {
+/**
+ * Gets the clip rectangle applied to text.
+ * 
+ * @param x	Pointer receiving the screen X coordinate of the left edge of the clip rectangle.
+ * @param y	Pointer receiving the screen Y coordinate of the top edge of the clip rectangle.
+ * @param width	Pointer receiving the pixel width of the clip rectangle.
+ * @param height	Pointer receiving the pixel height of the clip rectangle.
+ * @return True if a clip rectangle is set.
+ */
+bool FreeTypeGX::getClipRect(int16_t *x, int16_t *y, uint16_t *width, uint16_t *height) {
+	*x = this->clipLeft;
+	*y = this->clipTop;
+	*width = this->clipRight - this->clipLeft;
+	*height = this->clipBottom - this->clipTop;
 
-		if(this->ftFace->glyph->format == FT_GLYPH_FORMAT_BITMAP) {
-			FT_Bitmap *glyphBitmap = &(this->ftFace->glyph->bitmap);
+	return this->clipEnabled;
+}
 
-			textureWidth = adjustTextureWidth(glyphBitmap->width, this->textureFormat);
-			textureHeight = adjustTextureHeight(glyphBitmap->rows, this->textureFormat);
+/**
+ * Sets the view matrix applied to compiled text.
+ * 
+ * As compiled text is positioned through a position matrix of its own, any view transformation loaded into the default
+ * position matrix by the application must also be supplied through this routine. If not set the identity matrix is used.
+ * 
+ * @param viewMatrix	The view matrix.
+ */
+void FreeTypeGX::setTextViewMatrix(Mtx viewMatrix) {
+	guMtxCopy(viewMatrix, this->textViewMatrix);
+}
 
-			this->fontData[charCode] = (ftgxCharData){
-				this->ftFace->glyph->advance.x >> 6,
-				gIndex,
-				textureWidth,
-				textureHeight,
-				this->ftFace->glyph->bitmap_top,
-				this->ftFace->glyph->bitmap_top,
-				textureHeight - this->ftFace->glyph->bitmap_top,
-				NULL
-			};
-			this->loadGlyphData(glyphBitmap, &this->fontData[charCode]);
+/**
+ * Determines whether the display list of compiled text can still be drawn.
+ * 
+ * @param handle	The compiled text.
+ * @return The point size the text was compiled from, or NULL if it has been released, the vertex format has changed or
+ * the texture coordinate array indexed by the display list has been replaced.
+ */
+ftgxFontSize* FreeTypeGX::getTextHandleSize(ftgxTextHandle *handle) {
+	if(handle->sizeSerial == 0 || handle->vertexIndex != this->vertexIndex || handle->compactVertices != this->compactVertices) {
+		return NULL;
+	}
 
-			return &this->fontData[charCode];
+	for(std::vector<ftgxFontSize*>::iterator i = this->fontSizes.begin(); i != this->fontSizes.end(); i++) {
+		if((*i)->sizeSerial == handle->sizeSerial) {
+			if(handle->texCoordDesc != GX_DIRECT && ((*i)->texCoordArray != handle->texCoordArray || (*i)->texCoordCompact != handle->compactVertices)) {
+				return NULL;
+			}
+			return *i;
 		}
 	}
 
@@ -397,230 +4301,485 @@ ftgxCharData *FreeTypeGX::cacheGlyphData(wchar_t charCode) {
 }
 
 /**
- * Locates each character in this wrapper's configured font face and process them.
- *
- * This routine locates each character in the configured font face and renders the glyph's bitmap.
- * Each bitmap and relevant information is loaded into its own quickly addressable structure within an instance-specific map.
+ * Compiles the display list of a text handle.
+ * 
+ * This routine lays out the text of the handle relative to its origin with the active point size and records the glyph
+ * quads into a newly allocated display list, replacing any previous display list. Glyph textures still being rendered by
+ * the asynchronous caching thread are rendered immediately so that the display list is complete.
+ * 
+ * @param handle	The compiled text.
+ * @return True if the display list was compiled successfully.
  */
-uint16_t FreeTypeGX::cacheGlyphDataComplete() {
-	uint16_t i = 0;
-	FT_UInt gIndex;
-	FT_ULong charCode = FT_Get_First_Char( this->ftFace, &gIndex );
-	while ( gIndex != 0 ) {
+bool FreeTypeGX::buildTextHandle(ftgxTextHandle *handle) {
+	uint16_t x_offset = 0, y_offset = 0;
 
-		if(this->cacheGlyphData(charCode) != NULL) {
-			i++;
+	free(handle->displayList);
+	handle->displayList = NULL;
+	handle->displayListSize = 0;
+	handle->sizeSerial = 0;
+
+	if(this->fontSize == NULL) {
+		return false;
+	}
+
+	this->getStyleOffsets(wideTextReader(handle->text), handle->textStyle, &handle->textWidth, &x_offset, &y_offset);
+	handle->printed = this->batchGlyphs(-x_offset, -y_offset, wideTextReader(handle->text), handle->textColor, 0, true, false);
+	if(handle->textStyle & FTGX_STYLE_MASK) {
+		this->batchTextFeature(-x_offset, -y_offset, handle->textWidth, handle->textStyle, handle->textColor, false);
+	}
+	handle->vertexIndex = this->vertexIndex;
+	handle->compactVertices = this->compactVertices;
+	handle->texCoordDesc = this->getTexCoordDesc(this->fontSize);
+	handle->texCoordArray = this->fontSize->texCoordArray;
+
+	if(!this->glyphBatch.empty()) {
+		uint32_t listCapacity = (this->glyphBatch.size() * (this->compactVertices ? 32 : 64) + this->fontSize->texturePages.size() * 128 + 128 + 31) & ~31;
+		bool texCacheDirty = this->gxTexCacheDirty;
+
+		handle->displayList = memalign(32, listCapacity);
+		if(handle->displayList == NULL) {
+			this->glyphBatch.clear();
+			this->gxTexCacheDirty = texCacheDirty;
+			return false;
 		}
 
-		charCode = FT_Get_Next_Char( this->ftFace, charCode, &gIndex );
+		this->resetState();
+		this->gxTexCacheDirty = false;
+
+		GX_BeginDispList(handle->displayList, listCapacity);
+		this->emitGlyphBatch(handle->texCoordDesc);
+		handle->displayListSize = GX_EndDispList();
+
+		this->gxTexCacheDirty = texCacheDirty;
+		this->resetState();
+
+		if(handle->displayListSize == 0) {
+			free(handle->displayList);
+			handle->displayList = NULL;
+			return false;
+		}
 	}
-	
-	return i;
+
+	handle->sizeSerial = this->fontSize->sizeSerial;
+
+	return true;
+}
+
+/**
+ * Enables or disables deferred rendering.
+ * 
+ * When enabled drawText no longer draws the text immediately but queues its glyph and text feature quads until
+ * flush is called, typically once per frame. This allows the quads of all strings drawn within a frame to be batched
+ * together. Compiled text is still drawn immediately. Disabling deferred rendering flushes any queued text in call order.
+ * 
+ * @param enabled	The enabled state of deferred rendering.
+ * @return The enabled state of deferred rendering.
+ */
+bool FreeTypeGX::setDeferredRenderingEnabled(bool enabled) {
+	if(!enabled) {
+		this->flush(true);
+	}
+
+	return this->deferredRendering = enabled;
+}
+
+/**
+ * Gets the enabled state of deferred rendering.
+ * 
+ * @return The enabled state of deferred rendering.
+ */
+bool FreeTypeGX::getDeferredRenderingEnabled() {
+	return this->deferredRendering;
+}
+
+/**
+ * Enables or disables distance field glyphs.
+ * 
+ * When enabled glyphs are rendered only once at FTGX_DISTANCE_FIELD_SIZE into signed distance field textures and every
+ * point size requested through setSize or loadFont scales the same glyph caches, so that changing the point size, for
+ * instance to animate or zoom text, neither renders any glyph again nor holds further textures. The glyph edges are
+ * reconstructed from the field by a second TEV stage while the alpha compare unit discards the texels outside of the
+ * glyphs, both of which are restored once the text has been drawn. The GX_TF_I8 texture format is recommended as it holds
+ * the field at full precision in half the memory of GX_TF_IA8. Distance field glyphs are always rendered synchronously.
+ * 
+ * @param enabled	The enabled state of distance field glyphs.
+ * @return The enabled state of distance field glyphs.
+ */
+bool FreeTypeGX::setDistanceFieldEnabled(bool enabled) {
+	if(this->distanceFieldEnabled != enabled) {
+		this->distanceFieldEnabled = enabled;
+		this->clearTextWidthCache();
+		if(this->fontSize != NULL) {
+			this->setSize(this->renderSize);
+		}
+	}
+
+	return this->distanceFieldEnabled;
 }
 
 /**
- * Loads the rendered bitmap into the relevant structure's data buffer.
+ * Gets the enabled state of distance field glyphs.
  * 
- * This routine does a simple byte-wise copy of the glyph's rendered 8-bit grayscale bitmap into the structure's buffer.
- * Each byte is converted from the bitmap's intensity value into the a uint32_t RGBA value.
+ * @return The enabled state of distance field glyphs.
+ */
+bool FreeTypeGX::getDistanceFieldEnabled() {
+	return this->distanceFieldEnabled;
+}
+
+/**
+ * Sets the number of horizontal subpixel phases at which glyphs are positioned.
  * 
- * @param bmp	A pointer to the most recently rendered glyph's bitmap.
- * @param charData	A pointer to an allocated ftgxCharData structure whose data represent that of the last rendered glyph.
+ * With more than one phase the pen advances by the unrounded advance widths and kerning of unhinted glyphs, and each
+ * glyph is drawn with a texture rendered at the subpixel phase nearest to its position, which evens out the spacing of
+ * small text. Phase variants are rendered only as they are first drawn and are bounded by FTGX_SUBPIXEL_MEMORY_LIMIT bytes
+ * of textures per point size. Subpixel glyphs are always rendered synchronously and distance field glyphs are always
+ * positioned on whole pixels. The active point size is reloaded if the number of phases changes.
+ * 
+ * @param phases	The number of subpixel phases, from one for whole pixel positioning to FTGX_SUBPIXEL_MAX_PHASES.
+ * @return The resultant number of subpixel phases.
  */
-void FreeTypeGX::loadGlyphData(FT_Bitmap *bmp, ftgxCharData *charData) {
-	
-	uint32_t *glyphData = (uint32_t *)memalign(32, charData->textureWidth * charData->textureHeight * 4);
-	memset(glyphData, 0x00, charData->textureWidth * charData->textureHeight * 4);
-	
-	uint8_t *src = (uint8_t *)bmp->buffer;
-	uint32_t *dest = glyphData, *ptr = dest;
+uint8_t FreeTypeGX::setSubpixelPhases(uint8_t phases) {
+	phases = phases < 1 ? 1 : (phases > FTGX_SUBPIXEL_MAX_PHASES ? FTGX_SUBPIXEL_MAX_PHASES : phases);
 
-	for (uint16_t imagePosY = 0; imagePosY < bmp->rows; imagePosY++) {
-		for (uint16_t imagePosX = 0; imagePosX < bmp->width; imagePosX++) {
-			*ptr++ = EXPLODE_UINT8_TO_UINT32(*src);
-			src++;
+	if(this->subpixelPhases != phases) {
+		this->subpixelPhases = phases;
+		this->clearTextWidthCache();
+		if(this->fontSize != NULL) {
+			this->setSize(this->renderSize);
 		}
-		ptr = dest += charData->textureWidth;
-	}
-	
-	switch(this->textureFormat) {
-		case GX_TF_I4:
-			charData->glyphDataTexture = Metaphrasis::convertBufferToI4(glyphData, charData->textureWidth, charData->textureHeight);
-			break;
-		case GX_TF_I8:
-			charData->glyphDataTexture = Metaphrasis::convertBufferToI8(glyphData, charData->textureWidth, charData->textureHeight);
-			break;
-		case GX_TF_IA4:
-			charData->glyphDataTexture = Metaphrasis::convertBufferToIA4(glyphData, charData->textureWidth, charData->textureHeight);
-			break;
-		case GX_TF_IA8:
-			charData->glyphDataTexture = Metaphrasis::convertBufferToIA8(glyphData, charData->textureWidth, charData->textureHeight);
-			break;
-		case GX_TF_RGB565:
-			charData->glyphDataTexture = Metaphrasis::convertBufferToRGB565(glyphData, charData->textureWidth, charData->textureHeight);
-			break;
-		case GX_TF_RGB5A3:
-			charData->glyphDataTexture = Metaphrasis::convertBufferToRGB5A3(glyphData, charData->textureWidth, charData->textureHeight);
-			break;
-		case GX_TF_RGBA8:
-		default:
-			charData->glyphDataTexture = Metaphrasis::convertBufferToRGBA8(glyphData, charData->textureWidth, charData->textureHeight);
-			break;
 	}
 
-	free(glyphData);
+	return this->subpixelPhases;
 }
 
 /**
- * Determines the x offset of the rendered string.
+ * Gets the number of horizontal subpixel phases at which glyphs are positioned.
  * 
- * This routine calculates the x offset of the rendered string based off of a supplied positional format parameter.
+ * @return The number of subpixel phases.
+ */
+uint8_t FreeTypeGX::getSubpixelPhases() {
+	return this->subpixelPhases;
+}
+
+/**
+ * Gets the texture memory held by the subpixel phase variants of all point sizes.
  * 
- * @param width	Current pixel width of the string.
- * @param format	Positional format of the string.
+ * @return The size in bytes of the phase variant textures.
  */
-uint16_t FreeTypeGX::getStyleOffsetWidth(uint16_t width, uint16_t format) {
-	switch(format & FTGX_JUSTIFY_MASK) {
-		case FTGX_JUSTIFY_LEFT:
-			return 0;
-		case FTGX_JUSTIFY_CENTER:
-			return width >> 1;
-		case FTGX_JUSTIFY_RIGHT:
-			return width;
-		default:
-			return 0;
+uint32_t FreeTypeGX::getSubpixelMemoryUsage() {
+	uint32_t memoryUsage = 0;
+
+	for(std::vector<ftgxFontSize*>::iterator i = this->fontSizes.begin(); i != this->fontSizes.end(); i++) {
+		memoryUsage += (*i)->phaseTextureSize;
 	}
+
+	return memoryUsage;
 }
 
 /**
- * Determines the y offset of the rendered string.
+ * Submits all text queued by drawText while deferred rendering is enabled.
  * 
- * This routine calculates the y offset of the rendered string based off of a supplied positional format parameter.
+ * This routine sorts the queued quads by point size, with the glyph and text feature quads of each point size grouped by
+ * texture atlas page, and submits them with as few state changes and GX_Begin
+ * calls as possible. As overlapping text may then be drawn out of order the call order can be preserved instead, in which
+ * case only consecutive quads sharing a texture atlas page are batched together.
  * 
- * @param format	Positional format of the string.
+ * @param preserveOrder	Optional flag specifying that the queued quads should be drawn in call order. If not specified default value is false.
  */
-uint16_t FreeTypeGX::getStyleOffsetHeight(uint16_t format) {
-	switch(format & FTGX_ALIGN_MASK) {
-		case FTGX_ALIGN_TOP:
-			return -this->ftAscender;
-		case FTGX_ALIGN_MIDDLE:
-			return -(this->ftDescender + this->ftAscender) >> 1;
-		case FTGX_ALIGN_BOTTOM:
-			return this->ftDescender;
-		default:
-			return 0;
+void FreeTypeGX::flush(bool preserveOrder) {
+	if(this->textQueue.empty()) {
+		return;
+	}
+
+	if(!preserveOrder) {
+		std::stable_sort(this->textQueue.begin(), this->textQueue.end(), this->compactVertices ? compareQueuedQuadSizeColor : compareQueuedQuadSize);
+	}
+
+	ftgxFontSize *activeSize = this->fontSize;
+	size_t runStart = 0, runEnd;
+
+	this->resetState();
+
+	while(runStart < this->textQueue.size()) {
+		for(runEnd = runStart + 1; runEnd < this->textQueue.size(); runEnd++) {
+			if(!this->isSameQueueRun(&this->textQueue[runStart], &this->textQueue[runEnd], preserveOrder)) {
+				break;
+			}
+		}
+
+		this->fontSize = this->textQueue[runStart].fontSize;
+		for(size_t i = runStart; i < runEnd; i++) {
+			this->glyphBatch.push_back(this->textQueue[i].glyphQuad);
+		}
+		this->flushGlyphBatch(this->textQueue[runStart].glyphQuad.quadColor);
+
+		runStart = runEnd;
 	}
+
+	this->fontSize = activeSize;
+	this->setDefaultMode();
+	this->textQueue.clear();
 }
 
 /**
- * Returns the FreeTypeGX font character data structure.
- *
- * This routine locates the currently cached FreeTypeGX ftgxCharData structure for the supplied wide character. If the
- * structure has not been loaded and cached the routine initialized the loading and caching of the structure for that
- * data chatracter.
- *
- * @param character	Character whose information needs to be retrieved.
- * @return The font structure for the supplied character.
+ * Determines whether two queued quads can be submitted within the same batch.
+ * 
+ * @param a	The first quad of the batch.
+ * @param b	The candidate quad.
+ * @param preserveOrder	Flag specifying that the queued quads are drawn in call order.
+ * @return True if the candidate quad can be submitted within the batch.
  */
-ftgxCharData* FreeTypeGX::getCharacter(wchar_t character) {
-	if( this->fontData.find(character) != this->fontData.end() ) {
-		return &this->fontData[character];
+bool FreeTypeGX::isSameQueueRun(ftgxQueuedQuad *a, ftgxQueuedQuad *b, bool preserveOrder) {
+	if(a->fontSize != b->fontSize) {
+		return false;
+	}
+	if(this->compactVertices && *(uint32_t *)&a->glyphQuad.quadColor != *(uint32_t *)&b->glyphQuad.quadColor) {
+		return false;
 	}
 
-	return this->cacheGlyphData(character);
+	return !preserveOrder || a->glyphQuad.texturePage == b->glyphQuad.texturePage;
 }
 
 /**
- * Processes the supplied text string and prints the results at the specified coordinates.
- * 
- * This routine processes each character of the supplied text string, loads the relevant preprocessed bitmap buffer,
- * a texture from said buffer, and loads the resultant texture into the EFB.
+ * Determines the width and positional offsets of a text string.
  * 
- * @param x	Screen X coordinate at which to output the text.
- * @param y Screen Y coordinate at which to output the text. Note that this value corresponds to the text string origin and not the top or bottom of the glyphs.
- * @param text	NULL terminated string to output.
- * @param color	Optional color to apply to the text characters. If not specified default value is ftgxWhite: (GXColor){0xff, 0xff, 0xff, 0xff}
+ * @param reader	Reader positioned at the start of the text string. Only wide text strings make use of the text width cache.
  * @param textStyle	Flags which specify any styling which should be applied to the rendered string.
- * @return The number of characters printed.
+ * @param textWidth	Output pixel width of the string. This is only calculated if required by the styling.
+ * @param offsetX	Output x offset of the string.
+ * @param offsetY	Output y offset of the string.
  */
-uint16_t FreeTypeGX::drawText(int16_t x, int16_t y, wchar_t *text, GXColor color, uint16_t textStyle) {
-	uint16_t x_pos = x, printed = 0;
-	uint16_t x_offset = 0, y_offset = 0;
-	GXTexObj glyphTexture;
-	FT_Vector pairDelta;
-
-	uint16_t textWidth = 0;
+void FreeTypeGX::getStyleOffsets(ftgxTextReader reader, uint16_t textStyle, uint16_t *textWidth, uint16_t *offsetX, uint16_t *offsetY) {
+	*textWidth = 0;
+	*offsetX = 0;
+	*offsetY = 0;
 
-	if(this->widthCachingEnabled) {
-		textWidth = this->cacheTextWidth.find(text) != this->cacheTextWidth.end() ? this->cacheTextWidth[text] : this->cacheTextWidth[text] = this->getWidth(text);
+	if(textStyle & (FTGX_JUSTIFY_CENTER | FTGX_JUSTIFY_RIGHT | FTGX_STYLE_MASK)) {
+		*textWidth = reader.wideText != NULL ? this->getCachedWidth((wchar_t *)reader.wideText) : this->measureWidth(reader);
 	}
 
 	if(textStyle & FTGX_JUSTIFY_MASK) {
-		x_offset = this->getStyleOffsetWidth(textWidth > 0 ? textWidth : this->getWidth(text), textStyle);
+		*offsetX = this->getStyleOffsetWidth(*textWidth, textStyle);
 	}
 
 	if(textStyle & FTGX_ALIGN_MASK) {
-		y_offset = this->getStyleOffsetHeight(textStyle);
+		*offsetY = this->getStyleOffsetHeight(textStyle);
 	}
-	
-	int i = 0;
-	while(text[i]) {
-		if(maxVideoWidth > 0 && (x_pos > maxVideoWidth)) {
+}
+
+/**
+ * Lays out the glyphs of a text string into the pending glyph quads.
+ * 
+ * This routine processes each character of the supplied text string, applying kerning between the glyphs, and appends a
+ * quad for each visible glyph to the pending glyph quads. The pen advances in 26.6 fixed point pixels of the active glyph
+ * caches and is scaled to the requested point size for each glyph, so that neither the rounding of scaled distance field
+ * glyphs nor that of subpixel positions accumulates along the string. Glyphs whose position falls between whole pixels
+ * are drawn with the glyph texture rendered at the nearest subpixel phase.
+ * 
+ * @param x	Screen X coordinate of the text origin.
+ * @param y	Screen Y coordinate of the text origin.
+ * @param reader	Reader positioned at the start of the text string to lay out.
+ * @param color	Color to apply to the glyph quads.
+ * @param maxX	Screen X coordinate past which no further glyphs are laid out, or zero for no limit.
+ * @param waitForTextures	Flag specifying that glyph textures queued for asynchronous rendering should be rendered immediately rather than omitted.
+ * @param clipGlyphs	Flag specifying that the glyph quads should be clipped to the clip rectangle.
+ * @return The number of characters laid out.
+ */
+uint16_t FreeTypeGX::batchGlyphs(int16_t x, int16_t y, ftgxTextReader reader, GXColor color, uint16_t maxX, bool waitForTextures, bool clipGlyphs) {
+	int16_t x_pos = x;
+	int32_t origin = x * 64, pen = 0;
+	uint8_t phase = 0;
+	uint16_t printed = 0;
+	uint16_t previousIndex = 0;
+	wchar_t character;
+
+	while((character = readCharacter(&reader)) != 0) {
+		if((maxX > 0 && x_pos > maxX) || (clipGlyphs && x_pos >= this->clipRight)) {
 			break;
 		}
 
-		ftgxCharData* glyphData = getCharacter(text[i]);
+		ftgxCharData* glyphData = getCharacter(character);
 		
 		if(glyphData != NULL) {
-			if(this->ftKerningEnabled && i) {
-				FT_Get_Kerning( this->ftFace, this->fontData[text[i - 1]].glyphIndex, glyphData->glyphIndex, FT_KERNING_DEFAULT, &pairDelta );
-				x_pos += pairDelta.x >> 6;
+			if(this->ftKerningEnabled && previousIndex) {
+				pen += this->getKerning(previousIndex, glyphData->glyphIndex);
 			}
 
-			GX_InitTexObj(&glyphTexture, glyphData->glyphDataTexture, glyphData->textureWidth, glyphData->textureHeight, this->textureFormat, GX_CLAMP, GX_CLAMP, GX_FALSE);
-			this->copyTextureToFramebuffer(&glyphTexture, glyphData->textureWidth, glyphData->textureHeight, x_pos - x_offset, y - glyphData->renderOffsetY - y_offset, color);
+			this->batchGlyph(glyphData, origin, pen, y, color, waitForTextures, clipGlyphs);
 
-			x_pos += glyphData->glyphAdvanceX;
+			pen += glyphData->glyphAdvanceX;
+			x_pos = this->snapPosition(origin + this->scalePosition(pen), &phase);
+			previousIndex = glyphData->glyphIndex;
 			printed++;
 		}
+	}
 
-		i++;
+	return printed;
+}
+
+/**
+ * Appends the quad of a single glyph to the pending glyph quads.
+ * 
+ * This routine renders the glyph texture if required, selects the subpixel phase variant of the texture nearest to the
+ * pen position and appends the resulting quad unless the glyph has no visible texture yet.
+ * 
+ * @param glyphData	A pointer to the ftgxCharData structure of the glyph.
+ * @param origin	Screen X coordinate of the pen origin in 26.6 fixed point pixels.
+ * @param pen	Pen position of the glyph from the origin in 26.6 fixed point pixels of the active glyph caches.
+ * @param y	Screen Y coordinate of the text baseline.
+ * @param color	Color to apply to the glyph quad.
+ * @param waitForTextures	Flag specifying that a glyph texture queued for asynchronous rendering should be rendered immediately rather than omitted.
+ * @param clipGlyphs	Flag specifying that the glyph quad should be clipped to the clip rectangle.
+ */
+void FreeTypeGX::batchGlyph(ftgxCharData *glyphData, int32_t origin, int32_t pen, int16_t y, GXColor color, bool waitForTextures, bool clipGlyphs) {
+	uint8_t phase;
+	uint16_t padding = this->fontSize->texturePadding;
+	int16_t x_pos = this->snapPosition(origin + this->scalePosition(pen), &phase);
+
+	ftgxCharTexture* glyphTexture = this->getCharacterTexture(glyphData);
+	if(glyphTexture->texturePage == FTGX_TEXTURE_QUEUED && waitForTextures) {
+		this->cacheGlyphTexture(glyphData, glyphTexture);
 	}
 
-	if(textStyle & FTGX_STYLE_MASK) {
-		this->drawTextFeature(x - x_offset, y - y_offset, textWidth > 0 ? textWidth : textWidth = this->getWidth(text), textStyle, color);
+	uint16_t glyphSlot = glyphTexture - &this->fontSize->glyphTextures[0];
+	if(phase != 0 && glyphTexture->textureWidth && glyphTexture->textureHeight && glyphTexture->texturePage != FTGX_TEXTURE_QUEUED) {
+		glyphTexture = this->getPhaseTexture(glyphData, glyphTexture, phase);
+		glyphSlot = FTGX_GLYPH_UNINDEXED;
 	}
 
-	return printed;
+	if(!glyphTexture->textureWidth || !glyphTexture->textureHeight || glyphTexture->texturePage == FTGX_TEXTURE_QUEUED) {
+		return;
+	}
+
+	int16_t quadLeft = x_pos, quadWidth = glyphTexture->textureWidth;
+	if(padding) {
+		quadLeft = (origin + this->scalePosition(pen - (padding << 6)) + 32) >> 6;
+		quadWidth = ((origin + this->scalePosition(pen + ((glyphTexture->textureWidth - padding) << 6)) + 32) >> 6) - quadLeft;
+	}
+	int16_t quadTop = y - this->scaleMetric((int16_t)glyphData->renderOffsetY);
+	int16_t quadHeight = y - this->scaleMetric((int16_t)glyphData->renderOffsetY - glyphTexture->textureHeight) - quadTop;
+
+	/* Glyphs scaled down to nothing would otherwise wrap around to giant quads */
+	if(quadWidth <= 0 || quadHeight <= 0) {
+		return;
+	}
+
+	ftgxGlyphQuad glyphQuad = {
+		quadLeft,
+		quadTop,
+		(uint16_t)quadWidth,
+		(uint16_t)quadHeight,
+		color,
+		glyphTexture->texturePage,
+		glyphSlot,
+		glyphTexture->textureCoordLeft,
+		glyphTexture->textureCoordTop,
+		glyphTexture->textureCoordRight,
+		glyphTexture->textureCoordBottom
+	};
+
+	if(!clipGlyphs || this->clipGlyphQuad(&glyphQuad)) {
+		this->glyphBatch.push_back(glyphQuad);
+	}
 }
 
 /**
- * \overload
+ * Clips a quad to the clip rectangle.
+ * 
+ * This routine trims the parts of the quad outside of the clip rectangle, adjusting its texture coordinates by the same
+ * proportion so that the visible part of the glyph is left unchanged. As the texture coordinates of a trimmed quad no
+ * longer match the texture coordinate array its glyph index is replaced by FTGX_GLYPH_UNINDEXED.
+ * 
+ * @param quad	The quad to clip.
+ * @return True if any part of the quad lies within the clip rectangle.
  */
-uint16_t FreeTypeGX::drawText(int16_t x, int16_t y, wchar_t const *text, GXColor color, uint16_t textStyle) {
-	return this->drawText(x, y, (wchar_t *)text, color, textStyle);
+bool FreeTypeGX::clipGlyphQuad(ftgxGlyphQuad *quad) {
+	int16_t left = quad->screenX, top = quad->screenY;
+	int16_t right = left + quad->quadWidth, bottom = top + quad->quadHeight;
+
+	if(right <= this->clipLeft || left >= this->clipRight || bottom <= this->clipTop || top >= this->clipBottom) {
+		return false;
+	}
+	if(left >= this->clipLeft && right <= this->clipRight && top >= this->clipTop && bottom <= this->clipBottom) {
+		return true;
+	}
+
+	f32 texelWidth = (quad->textureCoordRight - quad->textureCoordLeft) / quad->quadWidth;
+	f32 texelHeight = (quad->textureCoordBottom - quad->textureCoordTop) / quad->quadHeight;
+
+	if(left < this->clipLeft) {
+		quad->textureCoordLeft += (this->clipLeft - left) * texelWidth;
+		left = this->clipLeft;
+	}
+	if(right > this->clipRight) {
+		quad->textureCoordRight -= (right - this->clipRight) * texelWidth;
+		right = this->clipRight;
+	}
+	if(top < this->clipTop) {
+		quad->textureCoordTop += (this->clipTop - top) * texelHeight;
+		top = this->clipTop;
+	}
+	if(bottom > this->clipBottom) {
+		quad->textureCoordBottom -= (bottom - this->clipBottom) * texelHeight;
+		bottom = this->clipBottom;
+	}
+
+	quad->screenX = left;
+	quad->screenY = top;
+	quad->quadWidth = right - left;
+	quad->quadHeight = bottom - top;
+	quad->glyphIndex = FTGX_GLYPH_UNINDEXED;
+
+	return true;
 }
 
 /**
- * Internal routine to draw the features for stylized text.
+ * Internal routine to lay out the features for stylized text.
  *
- * This routine creates a simple feature for stylized text.
+ * This routine appends a quad for each feature of stylized text to the pending glyph quads. The quads sample the solid
+ * texture of the active point size so that they are submitted within the same batch as the glyphs of the text.
  *
  * @param x	Screen X coordinate of the text baseline.
  * @param y	Screen Y coordinate of the text baseline.
  * @param width	Pixel width of the text string.
  * @param textStyle	Flags which specify any styling which should be applied to the rendered string.
  * @param color	Color to be applied to the text feature.
+ * @param clipFeatures	Flag specifying that the features should be clipped to the clip rectangle.
  */
-void FreeTypeGX::drawTextFeature(int16_t x, int16_t y, uint16_t width, uint16_t textStyle, GXColor color) {
-	uint16_t featureHeight = this->ftPointSize >> 4 > 0 ? this->ftPointSize >> 4 : 1;
-	
-	if (textStyle & FTGX_STYLE_UNDERLINE ) {
-		this->copyFeatureToFramebuffer(width, featureHeight, x, y + 1, color);
+void FreeTypeGX::batchTextFeature(int16_t x, int16_t y, uint16_t width, uint16_t textStyle, GXColor color, bool clipFeatures) {
+	uint16_t featureHeight = this->renderSize >> 4 > 0 ? this->renderSize >> 4 : 1;
+	uint16_t solidSlot = this->getSolidSlot();
+
+	if(solidSlot == 0) {
+		return;
 	}
+	
+	ftgxCharTexture *solidTexture = &this->fontSize->glyphTextures[solidSlot - 1];
+	int16_t featureY[2] = { (int16_t)(y + 1), (int16_t)(y - (this->scaleMetric(this->fontSize->ascender) >> 2)) };
+	uint16_t featureStyle[2] = { FTGX_STYLE_UNDERLINE, FTGX_STYLE_STRIKE };
+
+	for(uint8_t feature = 0; feature < 2; feature++) {
+		if(!(textStyle & featureStyle[feature])) {
+			continue;
+		}
 
-	if (textStyle & FTGX_STYLE_STRIKE ) {
-		this->copyFeatureToFramebuffer(width, featureHeight, x, y - (this->ftAscender >> 2), color);
+		ftgxGlyphQuad featureQuad = {
+			x,
+			featureY[feature],
+			width,
+			featureHeight,
+			color,
+			solidTexture->texturePage,
+			(uint16_t)(solidSlot - 1),
+			solidTexture->textureCoordLeft,
+			solidTexture->textureCoordTop,
+			solidTexture->textureCoordRight,
+			solidTexture->textureCoordBottom
+		};
+
+		if(!clipFeatures || this->clipGlyphQuad(&featureQuad)) {
+			this->glyphBatch.push_back(featureQuad);
+		}
 	}
 }
 
@@ -628,150 +4787,306 @@ void FreeTypeGX::drawTextFeature(int16_t x, int16_t y, uint16_t width, uint16_t
  * Processes the supplied string and return the width of the string in pixels.
  * 
  * This routine processes each character of the supplied text string and calculates the width of the entire string.
- * Note that if precaching of the entire font set is not enabled any uncached glyph will be cached after the call to this function.
+ * Note that if precaching of the entire font set is not enabled the metrics of any uncached glyph will be cached after the call
+ * to this function. Glyph textures are not rendered until the glyph is first drawn.
  * 
  * @param text	NULL terminated string to calculate.
  * @return The width of the text string in pixels.
  */
 uint16_t FreeTypeGX::getWidth(wchar_t *text) {
-	uint16_t strWidth = 0;
-	FT_Vector pairDelta;
+	return this->measureWidth(wideTextReader(text));
+}
+
+/**
+ *
+ * \overload
+ */
+uint16_t FreeTypeGX::getWidth(wchar_t const *text) {
+	return this->getWidth((wchar_t *)text);
+}
+
+/**
+ * Processes the supplied UTF-8 string and return the width of the string in pixels.
+ * 
+ * This routine decodes the characters of the supplied text string in place without allocating any memory and calculates
+ * the width of the entire string in the same manner as the wide character overload.
+ * 
+ * @param text	UTF-8 string to calculate.
+ * @param length	Optional length of the string in bytes. If not specified default value is FTGX_TEXT_TERMINATED for a NULL terminated string.
+ * @return The width of the text string in pixels.
+ */
+uint16_t FreeTypeGX::getWidth(const char *text, uint32_t length) {
+	return this->measureWidth(utf8TextReader(text, length));
+}
+
+/**
+ * Calculates the width of the characters read from a text string.
+ * 
+ * @param reader	Reader positioned at the start of the text string.
+ * @return The width of the text string in pixels.
+ */
+uint16_t FreeTypeGX::measureWidth(ftgxTextReader reader) {
+	int32_t strWidth = 0;
+	uint16_t previousIndex = 0;
 	ftgxCharData* glyphData = NULL;
+	wchar_t character;
 
-	int i = 0;
-	while(text[i]) {
+	if(this->fontSize == NULL) {
+		return 0;
+	}
+
+	while((character = readCharacter(&reader)) != 0) {
 
-		glyphData = getCharacter(text[i]);
+		glyphData = getCharacter(character);
 		
 		if(glyphData != NULL) {
-			if(this->ftKerningEnabled && (i > 0)) {
-				FT_Get_Kerning( this->ftFace, this->fontData[text[i - 1]].glyphIndex, glyphData->glyphIndex, FT_KERNING_DEFAULT, &pairDelta );
-				strWidth += pairDelta.x >> 6;
+			if(this->ftKerningEnabled && previousIndex) {
+				strWidth += this->getKerning(previousIndex, glyphData->glyphIndex);
 			}
 
 			strWidth += glyphData->glyphAdvanceX;
+			previousIndex = glyphData->glyphIndex;
 		}
-
-		i++;
 	}
 
-	return strWidth;
+	return (this->scalePosition(strWidth) + 32) >> 6;
 }
 
 /**
- *
+ * Processes the supplied string and return the height of the string in pixels.
+ * 
+ * This routine processes each character of the supplied text string and calculates the height of the entire string.
+ * Note that if precaching of the entire font set is not enabled the metrics of any uncached glyph will be cached after the call
+ * to this function. Glyph textures are not rendered until the glyph is first drawn.
+ * 
+ * @param text	NULL terminated string to calculate.
+ * @return The height of the text string in pixels.
+ */
+uint16_t FreeTypeGX::getHeight(wchar_t *text) {
+	return this->measureHeight(wideTextReader(text));
+}
+
+/**
+ * 
  * \overload
  */
-uint16_t FreeTypeGX::getWidth(wchar_t const *text) {
-	return this->getWidth((wchar_t *)text);
+uint16_t FreeTypeGX::getHeight(wchar_t const *text) {
+	return this->getHeight((wchar_t *)text);
 }
 
 /**
- * Processes the supplied string and return the height of the string in pixels.
+ * Processes the supplied UTF-8 string and return the height of the string in pixels.
  * 
- * This routine processes each character of the supplied text string and calculates the height of the entire string.
- * Note that if precaching of the entire font set is not enabled any uncached glyph will be cached after the call to this function.
+ * This routine decodes the characters of the supplied text string in place without allocating any memory and calculates
+ * the height of the entire string in the same manner as the wide character overload.
  * 
- * @param text	NULL terminated string to calculate.
+ * @param text	UTF-8 string to calculate.
+ * @param length	Optional length of the string in bytes. If not specified default value is FTGX_TEXT_TERMINATED for a NULL terminated string.
  * @return The height of the text string in pixels.
  */
-uint16_t FreeTypeGX::getHeight(wchar_t *text) {
+uint16_t FreeTypeGX::getHeight(const char *text, uint32_t length) {
+	return this->measureHeight(utf8TextReader(text, length));
+}
+
+/**
+ * Calculates the height of the characters read from a text string.
+ * 
+ * @param reader	Reader positioned at the start of the text string.
+ * @return The height of the text string in pixels.
+ */
+uint16_t FreeTypeGX::measureHeight(ftgxTextReader reader) {
 	uint16_t strMax = 0, strMin = 0;
+	wchar_t character;
 
-	int i = 0;
-	while(text[i]) {
+	if(this->fontSize == NULL) {
+		return 0;
+	}
+
+	while((character = readCharacter(&reader)) != 0) {
 
-		ftgxCharData* glyphData = getCharacter(text[i]);
+		ftgxCharData* glyphData = getCharacter(character);
 
 		if(glyphData != NULL) {
 			strMax = glyphData->renderOffsetMax > strMax ? glyphData->renderOffsetMax : strMax;
 			strMin = glyphData->renderOffsetMin > strMin ? glyphData->renderOffsetMin : strMin;
 		}
-
-		i++;
 	}
 
-	return strMax + strMin;
+	return this->scaleMetric(strMax + strMin);
 }
 
 /**
+ * Draws the pending glyph quads of a text string.
  * 
- * \overload
+ * This routine submits the pending glyph quads to the EFB and restores the default mode, or queues them for flush should
+ * deferred rendering be enabled.
+ * 
+ * @param color	Color to apply to the glyph quads.
  */
-uint16_t FreeTypeGX::getHeight(wchar_t const *text) {
-	return this->getHeight((wchar_t *)text);
+void FreeTypeGX::submitGlyphBatch(GXColor color) {
+	if(this->deferredRendering) {
+		for(std::vector<ftgxGlyphQuad>::iterator i = this->glyphBatch.begin(); i != this->glyphBatch.end(); i++) {
+			this->textQueue.push_back((ftgxQueuedQuad){ *i, this->fontSize });
+		}
+		this->glyphBatch.clear();
+	}
+	else {
+		this->flushGlyphBatch(color);
+		this->setDefaultMode();
+	}
 }
 
 /**
- * Copies the supplied texture quad to the EFB. 
+ * Submits the pending glyph quads to the EFB.
  * 
- * This routine uses the in-built GX quad builder functions to define the texture bounds and location on the EFB target.
+ * This routine sets the TEV operation and vertex descriptors once per string rather than once per glyph and submits the
+ * pending glyph quads.
  * 
- * @param texObj	A pointer to the glyph's initialized texture object.
- * @param texWidth	The pixel width of the texture object.
- * @param texHeight	The pixel height of the texture object.
- * @param screenX	The screen X coordinate at which to output the rendered texture.
- * @param screenY	The screen Y coordinate at which to output the rendered texture.
- * @param color	Color to apply to the texture.
+ * @param color	Color to apply to the glyph quads.
  */
-void FreeTypeGX::copyTextureToFramebuffer(GXTexObj *texObj, f32 texWidth, f32 texHeight, int16_t screenX, int16_t screenY, GXColor color) {
+void FreeTypeGX::flushGlyphBatch(GXColor color) {
+	if(this->glyphBatch.empty()) {
+		return;
+	}
+
+	uint8_t texCoordDesc = this->getTexCoordDesc(this->fontSize);
+	if(texCoordDesc != GX_DIRECT) {
+		this->setTexCoordArray(this->fontSize->texCoordArray, this->fontSize->texCoordCompact);
+	}
 
-	GX_LoadTexObj(texObj, GX_TEXMAP0);
-	GX_InvalidateTexAll();
+	this->setGlyphMode(color, texCoordDesc, this->fontSize->texturePadding != 0);
+	this->emitGlyphBatch(texCoordDesc);
+}
 
-	GX_SetTevOp (GX_TEVSTAGE0, GX_MODULATE);
-	GX_SetVtxDesc (GX_VA_TEX0, GX_DIRECT);
+/**
+ * Sets the TEV operation and vertex descriptors used to draw glyph quads.
+ * 
+ * @param color	Color to apply to the glyph quads.
+ * @param texCoordDesc	Texture coordinate vertex descriptor type of the glyph quads.
+ * @param distanceField	Flag specifying that the glyph quads sample distance field textures.
+ */
+void FreeTypeGX::setGlyphMode(GXColor color, uint8_t texCoordDesc, bool distanceField) {
+	if(this->compactVertices) {
+		this->setKonstColor(color);
+		this->setTevOp(distanceField ? FTGX_TEVOP_DISTANCE_FIELD_KONST : FTGX_TEVOP_KONST);
+		this->setClrDesc(GX_NONE);
+	}
+	else {
+		this->setTevOp(distanceField ? FTGX_TEVOP_DISTANCE_FIELD : GX_MODULATE);
+	}
+	this->setTexDesc(texCoordDesc);
+}
 
-	GX_Begin(GX_QUADS, this->vertexIndex, 4);
-		GX_Position2s16(screenX, screenY);
-		GX_Color4u8(color.r, color.g, color.b, color.a);
-		GX_TexCoord2f32(0.0f, 0.0f);
+/**
+ * Submits the pending glyph quads grouped by texture atlas page.
+ * 
+ * This routine groups the pending glyph quads by texture atlas page and submits each group as a single batch. The batch
+ * is emptied once all of the quads have been submitted.
+ * 
+ * @param texCoordDesc	Texture coordinate vertex descriptor type of the glyph quads.
+ */
+void FreeTypeGX::emitGlyphBatch(uint8_t texCoordDesc) {
+	std::stable_sort(this->glyphBatch.begin(), this->glyphBatch.end(), compareGlyphQuadPage);
 
-		GX_Position2s16(texWidth + screenX, screenY);
-		GX_Color4u8(color.r, color.g, color.b, color.a);
-		GX_TexCoord2f32(1.0f, 0.0f);
+	size_t batchStart = 0, batchEnd;
+	while(batchStart < this->glyphBatch.size()) {
+		uint16_t texturePage = this->glyphBatch[batchStart].texturePage;
 
-		GX_Position2s16(texWidth + screenX, texHeight + screenY);
-		GX_Color4u8(color.r, color.g, color.b, color.a);
-		GX_TexCoord2f32(1.0f, 1.0f);
+		for(batchEnd = batchStart; batchEnd < this->glyphBatch.size() && batchEnd - batchStart < FTGX_MAX_BATCH_QUADS; batchEnd++) {
+			if(this->glyphBatch[batchEnd].texturePage != texturePage) {
+				break;
+			}
+		}
 
-		GX_Position2s16(screenX, texHeight + screenY);
-		GX_Color4u8(color.r, color.g, color.b, color.a);
-		GX_TexCoord2f32(0.0f, 1.0f);
-	GX_End();
+		this->copyTextureToFramebuffer(&this->fontSize->texturePages[texturePage], &this->glyphBatch[batchStart], batchEnd - batchStart, texCoordDesc);
+		batchStart = batchEnd;
+	}
 
-	this->setDefaultMode();
+	this->glyphBatch.clear();
 }
 
 /**
- * Creates a feature quad to the EFB. 
+ * Copies the supplied texture quads to the EFB. 
  * 
- * This function creates a simple quad for displaying stylized text.
- *
- * @param featureWidth	The pixel width of the quad.
- * @param featureHeight	The pixel height of the quad.
- * @param screenX	The screen X coordinate at which to output the quad.
- * @param screenY	The screen Y coordinate at which to output the quad.
- * @param color	Color to apply to the texture.
+ * This routine uses the in-built GX quad builder functions to define the texture bounds and location on the EFB target.
+ * All of the supplied quads must sample the same texture and are submitted within a single GX_Begin call.
+ * 
+ * @param page	A pointer to the atlas page sampled by the quads.
+ * @param quads	A pointer to the first quad to submit.
+ * @param quadCount	The number of quads to submit. This must not exceed FTGX_MAX_BATCH_QUADS.
+ * @param texCoordDesc	Texture coordinate vertex descriptor type of the quads. Indexed quads send the index of each corner within the texture coordinate array.
  */
-void FreeTypeGX::copyFeatureToFramebuffer(f32 featureWidth, f32 featureHeight, int16_t screenX, int16_t screenY, GXColor color) {
+void FreeTypeGX::copyTextureToFramebuffer(ftgxTexturePage *page, ftgxGlyphQuad *quads, uint16_t quadCount, uint8_t texCoordDesc) {
 
-	GX_SetTevOp (GX_TEVSTAGE0, GX_PASSCLR);
-	GX_SetVtxDesc (GX_VA_TEX0, GX_NONE);
-	
-	GX_Begin(GX_QUADS, this->vertexIndex, 4);
-		GX_Position2s16(screenX, screenY);
-		GX_Color4u8(color.r, color.g, color.b, color.a);
+	this->loadTexturePage(page);
 
- 		GX_Position2s16(featureWidth + screenX, screenY);
-		GX_Color4u8(color.r, color.g, color.b, color.a);
+	if(texCoordDesc != GX_DIRECT) {
+		GX_Begin(GX_QUADS, this->vertexIndex, quadCount << 2);
+		for(ftgxGlyphQuad *quad = quads; quad < quads + quadCount; quad++) {
+			uint16_t texCoordIndex = quad->glyphIndex << 2;
+			int16_t screenRight = (int16_t)(quad->quadWidth + quad->screenX);
+			int16_t screenBottom = (int16_t)(quad->quadHeight + quad->screenY);
+			int16_t screenX[4] = { quad->screenX, screenRight, screenRight, quad->screenX };
+			int16_t screenY[4] = { quad->screenY, quad->screenY, screenBottom, screenBottom };
 
-		GX_Position2s16(featureWidth + screenX, featureHeight + screenY);
-		GX_Color4u8(color.r, color.g, color.b, color.a);
+			for(uint8_t corner = 0; corner < 4; corner++) {
+				GX_Position2s16(screenX[corner], screenY[corner]);
+				if(!this->compactVertices) {
+					GX_Color4u8(quad->quadColor.r, quad->quadColor.g, quad->quadColor.b, quad->quadColor.a);
+				}
+				if(texCoordDesc == GX_INDEX8) {
+					GX_TexCoord1x8(texCoordIndex + corner);
+				}
+				else {
+					GX_TexCoord1x16(texCoordIndex + corner);
+				}
+			}
+		}
+		GX_End();
+		return;
+	}
 
-		GX_Position2s16(screenX, featureHeight + screenY);
-		GX_Color4u8(color.r, color.g, color.b, color.a);
-	GX_End();
+	if(this->compactVertices) {
+		GX_Begin(GX_QUADS, this->vertexIndex, quadCount << 2);
+		for(ftgxGlyphQuad *quad = quads; quad < quads + quadCount; quad++) {
+			uint16_t textureCoordLeft = quad->textureCoordLeft * (1 << FTGX_COMPACT_TEXCOORD_FRAC);
+			uint16_t textureCoordTop = quad->textureCoordTop * (1 << FTGX_COMPACT_TEXCOORD_FRAC);
+			uint16_t textureCoordRight = quad->textureCoordRight * (1 << FTGX_COMPACT_TEXCOORD_FRAC);
+			uint16_t textureCoordBottom = quad->textureCoordBottom * (1 << FTGX_COMPACT_TEXCOORD_FRAC);
 
-	this->setDefaultMode();
+			GX_Position2s16(quad->screenX, quad->screenY);
+			GX_TexCoord2u16(textureCoordLeft, textureCoordTop);
+
+			GX_Position2s16(quad->quadWidth + quad->screenX, quad->screenY);
+			GX_TexCoord2u16(textureCoordRight, textureCoordTop);
+
+			GX_Position2s16(quad->quadWidth + quad->screenX, quad->quadHeight + quad->screenY);
+			GX_TexCoord2u16(textureCoordRight, textureCoordBottom);
+
+			GX_Position2s16(quad->screenX, quad->quadHeight + quad->screenY);
+			GX_TexCoord2u16(textureCoordLeft, textureCoordBottom);
+		}
+		GX_End();
+		return;
+	}
+
+	GX_Begin(GX_QUADS, this->vertexIndex, quadCount << 2);
+	for(ftgxGlyphQuad *quad = quads; quad < quads + quadCount; quad++) {
+		GX_Position2s16(quad->screenX, quad->screenY);
+		GX_Color4u8(quad->quadColor.r, quad->quadColor.g, quad->quadColor.b, quad->quadColor.a);
+		GX_TexCoord2f32(quad->textureCoordLeft, quad->textureCoordTop);
+
+		GX_Position2s16(quad->quadWidth + quad->screenX, quad->screenY);
+		GX_Color4u8(quad->quadColor.r, quad->quadColor.g, quad->quadColor.b, quad->quadColor.a);
+		GX_TexCoord2f32(quad->textureCoordRight, quad->textureCoordTop);
+
+		GX_Position2s16(quad->quadWidth + quad->screenX, quad->quadHeight + quad->screenY);
+		GX_Color4u8(quad->quadColor.r, quad->quadColor.g, quad->quadColor.b, quad->quadColor.a);
+		GX_TexCoord2f32(quad->textureCoordRight, quad->textureCoordBottom);
+
+		GX_Position2s16(quad->screenX, quad->quadHeight + quad->screenY);
+		GX_Color4u8(quad->quadColor.r, quad->quadColor.g, quad->quadColor.b, quad->quadColor.a);
+		GX_TexCoord2f32(quad->textureCoordLeft, quad->textureCoordBottom);
+	}
+	GX_End();
 }
@@ -96,6 +96,22 @@
  * \code
  * freeTypeGX->loadFont(rursus_compact_mono_ttf, rursus_compact_mono_ttf_size, 64, true);
  * \endcode
+ * Once a font has been loaded its point size can be changed without reloading the font. The glyph caches of the most recently used point sizes are retained so that switching between them is cheap:
+ * \code
+ * freeTypeGX->setSize(32);
+ * \endcode
+ * Alternately a prebuilt font cache created with saveFontCache can be loaded instead of a font. This skips all FreeType parsing and rasterization at runtime:
+ * \code
+ * freeTypeGX->loadFontCache(rursus_cache_bin, rursus_cache_bin_size);
+ * \endcode
+ * Large fonts can also be cached incrementally during idle frames, for example while a loading screen is displayed:
+ * \code
+ * freeTypeGX->beginPrecache();
+ * while(!freeTypeGX->precacheStep(4000)) {
+ * 	drawLoadingBar(freeTypeGX->getPrecacheProgress());
+ * 	VIDEO_WaitVSync();
+ * }
+ * \endcode
  * \n
  * -# If necessary you can enable compatibility modes with concurrent libraries or systems. For more information on this feature see the documentation for setCompatibilityMode:
  * \code
@@ -116,6 +132,20 @@
  *                      (GXColor){0xff, 0xee, 0xaa, 0xff},
  *                      FTGX_JUSTIFY_CENTER | FTGX_ALIGN_BOTTOM | FTGX_STYLE_UNDERLINE);
  * \endcode
+ * When many strings are drawn each frame deferred rendering can be enabled, in which case drawText only queues the text and
+ * all queued text is submitted with as few state changes as possible once per frame:
+ * \code
+ * freeTypeGX->setDeferredRenderingEnabled(true);
+ * freeTypeGX->drawText(10, 25, _TEXT("FreeTypeGX"));
+ * freeTypeGX->drawText(10, 50, _TEXT("Rocks!"));
+ * freeTypeGX->flush();
+ * \endcode
+ * Text which rarely changes can be compiled into a display list once and drawn at any position each frame:
+ * \code
+ * ftgxTextHandle *label = freeTypeGX->compileText(_TEXT("FreeTypeGX Rocks!"));
+ * freeTypeGX->drawText(10, 25, label);
+ * freeTypeGX->releaseText(label);
+ * \endcode
  * \n
  * Currently style parameters are:
  * \li <i>FTGX_JUSTIFY_LEFT</i>
@@ -143,30 +173,495 @@
 #include <ft2build.h>
 #include FT_FREETYPE_H
 #include FT_BITMAP_H
+#include FT_OUTLINE_H
+#include FT_SIZES_H
+#include FT_TRUETYPE_TABLES_H
+#include FT_TRUETYPE_TAGS_H
 #include <Metaphrasis.h>
 
 #include <malloc.h>
 #include <string.h>
-#include <map>
+#include <vector>
+#include <deque>
+
+#ifdef GEKKO
+typedef lwp_t ftgxThread;		/**< Worker thread handle. */
+typedef mutex_t ftgxMutex;		/**< Mutex handle. */
+typedef cond_t ftgxCond;		/**< Condition variable handle. */
+#else
+#include <pthread.h>
+typedef pthread_t ftgxThread;
+typedef pthread_mutex_t ftgxMutex;
+typedef pthread_cond_t ftgxCond;
+#endif
 
 /*! \struct ftgxCharData_
  * 
- * Font face character glyph relevant data structure.
+ * Font face character glyph relevant metrics data structure.
  */
 typedef struct ftgxCharData_ {
-	uint16_t glyphAdvanceX;	/**< Character glyph X coordinate advance in pixels. */
+	uint32_t glyphAdvanceX;	/**< Character glyph X coordinate advance in 26.6 fixed point pixels. */
 	uint16_t glyphIndex;	/**< Character glyph index in the font face. */
 
-	uint16_t textureWidth;	/**< Texture width in pixels/bytes. */
-	uint16_t textureHeight;	/**< Texture glyph height in pixels/bytes. */
-
 	uint16_t renderOffsetY;	/**< Texture Y axis bearing offset. */
 	uint16_t renderOffsetMax;	/**< Texture Y axis bearing maximum value. */
 	uint16_t renderOffsetMin;	/**< Texture Y axis bearing minimum value. */
-
-	uint32_t* glyphDataTexture;	/**< Glyph texture bitmap data buffer. */
 } ftgxCharData;
 
+/*! \struct ftgxCharTexture_
+ * 
+ * Font face character glyph texture location data structure.
+ */
+typedef struct ftgxCharTexture_ {
+	uint16_t textureWidth;	/**< Texture width in pixels/bytes. */
+	uint16_t textureHeight;	/**< Texture glyph height in pixels/bytes. */
+
+	uint16_t texturePage;	/**< Index of the texture atlas page holding the glyph texture. */
+	f32 textureCoordLeft;	/**< Left S texture coordinate of the glyph within its atlas page. */
+	f32 textureCoordTop;	/**< Top T texture coordinate of the glyph within its atlas page. */
+	f32 textureCoordRight;	/**< Right S texture coordinate of the glyph within its atlas page. */
+	f32 textureCoordBottom;	/**< Bottom T texture coordinate of the glyph within its atlas page. */
+} ftgxCharTexture;
+
+#define FTGX_GLYPH_BLOCK_SIZE	256 /**< Number of character codes covered by a single block of the glyph table. */
+#define FTGX_GLYPH_PLANES		16	/**< Number of supplementary Unicode planes addressable by the glyph table. */
+#define FTGX_GLYPH_MISSING		0xffff	/**< Glyph slot value of a character which the font is unable to render. */
+#define FTGX_GLYPH_NONE			0xffffffff	/**< Glyph index value indicating that no glyph is loaded. */
+#define FTGX_TEXTURE_PENDING	0xffff	/**< Texture page value of a glyph whose texture has not yet been rendered. */
+#define FTGX_TEXTURE_QUEUED		0xfffe	/**< Texture page value of a glyph whose texture is being rendered by the asynchronous caching thread. */
+
+/*! \struct ftgxGlyphTable_
+ * 
+ * Character code to glyph slot lookup table.
+ * 
+ * The Basic Multilingual Plane is covered by a directly indexed array of slot blocks while the sparsely populated
+ * supplementary planes receive their own block directories only once a character from that plane is cached. Each
+ * slot holds one more than the index of the character's entry in the glyph metrics and texture arrays, zero if
+ * the character has not been cached, or FTGX_GLYPH_MISSING if the font is unable to render the character.
+ */
+typedef struct ftgxGlyphTable_ {
+	uint16_t *basicBlocks[0x10000 / FTGX_GLYPH_BLOCK_SIZE];	/**< Slot blocks of the Basic Multilingual Plane. */
+	uint16_t **planeBlocks[FTGX_GLYPH_PLANES];	/**< Slot block directories of the supplementary planes. */
+} ftgxGlyphTable;
+
+/*! \struct ftgxTextureShelf_
+ * 
+ * Single row of glyphs within a texture atlas page.
+ */
+typedef struct ftgxTextureShelf_ {
+	uint16_t shelfY;		/**< Y coordinate of the top of the shelf in pixels. */
+	uint16_t shelfHeight;	/**< Height of the shelf in pixels. */
+	uint16_t shelfUsed;		/**< Width of the shelf already occupied by glyphs in pixels. */
+} ftgxTextureShelf;
+
+/*! \struct ftgxTexturePage_
+ * 
+ * Texture atlas page into which the glyph textures are packed.
+ */
+typedef struct ftgxTexturePage_ {
+	uint16_t pageWidth;		/**< Texture width of the page in pixels. */
+	uint16_t pageHeight;	/**< Texture height of the page in pixels. */
+	uint16_t pageUsed;		/**< Height of the page already occupied by shelves in pixels. */
+	std::vector<ftgxTextureShelf> shelves;	/**< Shelves which have been opened within the page. */
+
+	uint32_t* pageDataTexture;	/**< Page texture data buffer in the target texture format. */
+	bool pageDataOwned;			/**< Flag indicating that the page texture data buffer is freed along with the page. */
+	GXTexObj pageTexture;		/**< Initialized texture object for the page. */
+} ftgxTexturePage;
+
+/*! \struct ftgxKerningPair_
+ * 
+ * Precomputed kerning adjustment of a pair of glyphs.
+ */
+typedef struct ftgxKerningPair_ {
+	uint32_t glyphPair;	/**< Left glyph index in the upper and right glyph index in the lower 16 bits. */
+	int16_t kerningX;	/**< Horizontal kerning adjustment in 26.6 fixed point pixels. */
+} ftgxKerningPair;
+
+#define FTGX_NUMBER_GLYPHS		12 /**< Number of number glyphs: the digits zero to nine, the minus sign and the decimal point. */
+
+/*! \struct ftgxFontSize_
+ * 
+ * Glyph caches of the font face rendered at a single point size.
+ */
+typedef struct ftgxFontSize_ {
+	FT_Size ftSize;			/**< FreeType FT_Size object of the point size. */
+	FT_UInt pointSize;		/**< Requested size of the rendered font. */
+	FT_Short ascender;		/**< Ascender value of the rendered font. */
+	FT_Short descender;		/**< Descender value of the rendered font. */
+	FT_Short extentTop;		/**< Maximum distance any glyph of the rendered font extends above the baseline. */
+	FT_Short extentBottom;	/**< Maximum distance any glyph of the rendered font extends below the baseline. */
+	uint16_t texturePadding;	/**< Distance field spread surrounding each glyph texture in pixels, or zero if the glyph textures hold coverage. */
+	uint8_t subpixelPhases;	/**< Number of horizontal subpixel phases at which glyphs are rendered, or one for whole pixel positioning. */
+	uint32_t lastUsed;		/**< Activation counter value of the most recent activation of the point size. */
+	uint32_t sizeSerial;	/**< Unique identifier of the point size used to match asynchronously rendered glyphs. */
+
+	ftgxGlyphTable glyphTable;	/**< Table which maps characters to their glyph data slots. */
+	std::vector<ftgxCharData> glyphMetrics;	/**< Glyph metrics data structures indexed by glyph slot. */
+	std::vector<ftgxCharTexture> glyphTextures;	/**< Glyph texture data structures indexed by glyph slot. */
+	std::vector<ftgxTexturePage> texturePages;	/**< Texture atlas pages which hold the rendered glyph textures. */
+	std::vector<ftgxCharTexture> phaseTextures;	/**< Glyph texture data structures of the subpixel phase variants, indexed by glyph slot and phase. */
+	uint32_t phaseTextureSize;	/**< Texture memory in bytes used by the subpixel phase variants. */
+	void* texCoordArray;		/**< 32 byte aligned vertex array of the four corner texture coordinates of each glyph slot, or NULL if not yet created. */
+	uint32_t texCoordCapacity;	/**< Number of glyph slots the texture coordinate array can hold. */
+	bool texCoordCompact;		/**< Flag indicating that the texture coordinate array holds 16-bit fixed point rather than floating point values. */
+	uint16_t replacementSlot;	/**< Resolved glyph slot of the replacement character, or zero if not yet resolved. */
+	uint16_t notdefSlot;		/**< Glyph slot of the undefined character glyph, or zero if not yet cached. */
+	uint16_t solidSlot;			/**< Glyph slot of the solid texture sampled by text feature quads, or zero if not yet reserved. */
+	uint16_t numberSlots[FTGX_NUMBER_GLYPHS];	/**< Glyph slots of the digits, minus sign and decimal point, or zero if unsupported by the font. */
+	bool numberSlotsResolved;	/**< Flag indicating that the number glyph slots have been resolved. */
+	bool tabularDigits;			/**< Flag indicating that all digits share a single advance width and that no kerning applies between them. */
+
+	bool kerningTableLoaded;	/**< Flag indicating that the font kerning data was loaded into the kerning table. */
+	std::vector<ftgxKerningPair> kerningPairs;	/**< Kerning adjustments of the font sorted by glyph pair. */
+} ftgxFontSize;
+
+/*! \struct ftgxCacheHeader_
+ * 
+ * Header of a prebuilt font cache buffer.
+ * 
+ * A font cache buffer holds the complete glyph caches of a single point size so that text can be rendered without
+ * FreeType parsing or rasterizing the font at runtime. It is made up of fixed size records whose fields are stored in big
+ * endian byte order at fixed offsets, so that a buffer created on any system can be loaded on any other. The header record
+ * is followed in order by charCount character records, glyphCount glyph records, pageCount page records and kerningCount
+ * kerning records. The texture data of each page follows at a 32 byte aligned offset in the GX texture format.
+ * 
+ * Header record (FTGX_CACHE_HEADER_SIZE bytes): cacheMagic (u32), cacheVersion, textureFormat, pointSize, ascender (s16),
+ * descender (s16), notdefSlot, glyphCount, pageCount, texturePadding, solidSlot (u16 each unless noted), charCount (u32),
+ * kerningCount (u32), cacheFlags (u16), reserved (u16).
+ * 
+ * Character record (FTGX_CACHE_CHAR_SIZE bytes): charCode (u32), glyphSlot (u16), reserved (u16).
+ * 
+ * Glyph record (FTGX_CACHE_GLYPH_SIZE bytes): glyphAdvanceX (u32), glyphIndex, renderOffsetY, renderOffsetMax, renderOffsetMin,
+ * textureWidth, textureHeight, texturePage, reserved (u16 each), textureCoordLeft, textureCoordTop, textureCoordRight,
+ * textureCoordBottom (IEEE 754 single precision each).
+ * 
+ * Page record (FTGX_CACHE_PAGE_SIZE bytes): pageWidth (u16), pageHeight (u16), pageOffset (u32) from the start of the buffer.
+ * 
+ * Kerning record (FTGX_CACHE_KERNING_SIZE bytes): glyphPair (u32), kerningX (s16).
+ */
+typedef struct ftgxCacheHeader_ {
+	uint32_t cacheMagic;	/**< FTGX_CACHE_MAGIC identifier of the buffer. */
+	uint16_t cacheVersion;	/**< FTGX_CACHE_VERSION format revision of the buffer. */
+	uint16_t textureFormat;	/**< Texture format (GX_TF_*) of the page textures. */
+	uint16_t pointSize;		/**< Point size at which the font was rendered. */
+	int16_t ascender;		/**< Ascender value of the rendered font. */
+	int16_t descender;		/**< Descender value of the rendered font. */
+	uint16_t notdefSlot;	/**< Glyph slot of the undefined character glyph, or zero if not included. */
+	uint16_t glyphCount;	/**< Number of glyph slots. */
+	uint16_t pageCount;		/**< Number of texture atlas pages. */
+	uint16_t texturePadding;	/**< Distance field spread surrounding each glyph texture, or zero if the glyph textures hold coverage. */
+	uint16_t solidSlot;		/**< Glyph slot of the solid texture sampled by text feature quads, or zero if not included. */
+	uint32_t charCount;		/**< Number of character to glyph slot mappings. */
+	uint32_t kerningCount;	/**< Number of kerning pairs. */
+	uint16_t cacheFlags;	/**< FTGX_CACHE_* flags describing the content of the buffer. */
+} ftgxCacheHeader;
+
+#define FTGX_CACHE_MAGIC	0x46544758	/**< Identifier of a prebuilt font cache buffer. */
+#define FTGX_CACHE_VERSION	5			/**< Format revision of prebuilt font cache buffers. */
+#define FTGX_CACHE_KERNING	0x0001		/**< Flag indicating that the kerning records hold the complete kerning table of the point size, rounded to whole pixels. */
+
+#define FTGX_CACHE_HEADER_SIZE	36	/**< Size in bytes of the header record of a prebuilt font cache buffer. */
+#define FTGX_CACHE_CHAR_SIZE	8	/**< Size in bytes of a character record of a prebuilt font cache buffer. */
+#define FTGX_CACHE_GLYPH_SIZE	36	/**< Size in bytes of a glyph record of a prebuilt font cache buffer. */
+#define FTGX_CACHE_PAGE_SIZE	8	/**< Size in bytes of a page record of a prebuilt font cache buffer. */
+#define FTGX_CACHE_KERNING_SIZE	6	/**< Size in bytes of a kerning record of a prebuilt font cache buffer. */
+#define FTGX_CACHE_PAGE_MAX		1024	/**< Maximum pixel width and height of a page within a prebuilt font cache buffer. */
+
+/*! \struct ftgxFieldPoint_
+ * 
+ * Offset to the nearest seed pixel used while computing a distance field.
+ */
+typedef struct ftgxFieldPoint_ {
+	int16_t offsetX;	/**< X offset to the nearest seed pixel. */
+	int16_t offsetY;	/**< Y offset to the nearest seed pixel. */
+} ftgxFieldPoint;
+
+#ifndef FTGX_DISTANCE_FIELD_SIZE
+#define FTGX_DISTANCE_FIELD_SIZE	64 /**< Reference point size at which distance field glyphs are rendered. */
+#endif
+
+#ifndef FTGX_DISTANCE_FIELD_SPREAD
+#define FTGX_DISTANCE_FIELD_SPREAD	8 /**< Distance in reference pixels covered by the distance field on either side of a glyph edge. */
+#endif
+
+#define FTGX_DISTANCE_FIELD_FAR		0x3fff /**< Offset of a distance field point which has no seed pixel yet. */
+
+/*! \struct ftgxRasterGlyph_
+ * 
+ * Glyph rendered by a rasterization worker awaiting insertion into the glyph caches.
+ */
+typedef struct ftgxRasterGlyph_ {
+	uint32_t charCode;			/**< Character code of the glyph. */
+	FT_UInt glyphIndex;			/**< Index of the glyph within the font face. */
+	bool glyphLoaded;			/**< Flag indicating that the worker rendered the glyph successfully. */
+	ftgxCharData glyphMetrics;	/**< Metrics of the rendered glyph. */
+	uint16_t textureWidth;		/**< Texture width of the rendered glyph in pixels. */
+	uint16_t textureHeight;		/**< Texture height of the rendered glyph in pixels. */
+	uint32_t* textureData;		/**< Glyph texture data in the target texture format, or NULL if the glyph is empty. */
+} ftgxRasterGlyph;
+
+/*! \struct ftgxRasterShard_
+ * 
+ * Share of a glyph rasterization batch assigned to a single worker.
+ * 
+ * Each worker renders every shardCount-th glyph of the batch starting at shardIndex using a font face of its own which
+ * is created from the shared font buffer.
+ */
+typedef struct ftgxRasterShard_ {
+	FT_Byte* fontBuffer;		/**< Font buffer shared by all workers. */
+	FT_Long fontBufferSize;		/**< Size of the shared font buffer. */
+	FT_UInt pointSize;			/**< Point size at which the glyphs are rendered. */
+	uint8_t textureFormat;		/**< Texture format (GX_TF_*) of the glyph textures. */
+	ftgxRasterGlyph* glyphs;	/**< Glyphs of the batch. */
+	uint32_t glyphCount;		/**< Number of glyphs in the batch. */
+	uint8_t shardIndex;			/**< Index of the first glyph rendered by the worker. */
+	uint8_t shardCount;			/**< Number of workers sharing the batch. */
+} ftgxRasterShard;
+
+#ifndef FTGX_RASTER_MAX_THREADS
+#define FTGX_RASTER_MAX_THREADS		16 /**< Maximum number of worker threads used to cache the complete character set of a font. */
+#endif
+#ifndef FTGX_RASTER_BATCH_SIZE
+#define FTGX_RASTER_BATCH_SIZE		1024 /**< Number of glyphs rendered by the worker threads before their textures are packed into the texture atlas. */
+#endif
+#ifndef FTGX_RASTER_STACK_SIZE
+#define FTGX_RASTER_STACK_SIZE		(64 * 1024) /**< Stack size of each worker thread in bytes. */
+#endif
+
+/*! \struct ftgxAsyncGlyph_
+ * 
+ * Glyph texture request processed by the asynchronous caching thread.
+ */
+typedef struct ftgxAsyncGlyph_ {
+	uint32_t sizeSerial;		/**< Identifier of the point size the glyph belongs to. */
+	FT_UInt pointSize;			/**< Point size at which the glyph is rendered. */
+	FT_UInt glyphIndex;			/**< Index of the glyph within the font face. */
+	uint16_t glyphSlot;			/**< Glyph slot of the glyph within the glyph caches of the point size. */
+	bool glyphLoaded;			/**< Flag indicating that the glyph was rendered successfully. */
+	uint16_t textureWidth;		/**< Texture width of the rendered glyph in pixels. */
+	uint16_t textureHeight;		/**< Texture height of the rendered glyph in pixels. */
+	int16_t bitmapTop;			/**< Distance from the baseline to the top of the rendered glyph in pixels. */
+	uint32_t* textureData;		/**< Glyph texture data in the target texture format, or NULL if the glyph is empty. */
+} ftgxAsyncGlyph;
+
+#ifndef FTGX_ASYNC_PUBLISH_LIMIT
+#define FTGX_ASYNC_PUBLISH_LIMIT	64 /**< Maximum number of asynchronously rendered glyphs loaded into the texture atlas per drawText call. */
+#endif
+
+#ifndef FTGX_WIDTH_CACHE_TEXT_LENGTH
+#define FTGX_WIDTH_CACHE_TEXT_LENGTH	32 /**< Maximum number of characters of a text string whose width is held by the text width cache. */
+#endif
+
+/*! \struct ftgxWidthCacheEntry_
+ * 
+ * Cached pixel width of a text string identified by its content.
+ */
+typedef struct ftgxWidthCacheEntry_ {
+	uint32_t textHash;	/**< Hash of the characters of the string. */
+	wchar_t text[FTGX_WIDTH_CACHE_TEXT_LENGTH];	/**< Characters of the string, compared on lookup as the hash only selects a bucket. */
+	uint16_t textLength;	/**< Number of characters in the string. */
+	uint16_t textSize;	/**< Point size of the font with which the string was measured. */
+	uint16_t textWidth;	/**< Pixel width of the string. */
+
+	uint16_t hashNext;	/**< Next entry within the same hash bucket. */
+	uint16_t usedPrev;	/**< Previous more recently used entry. */
+	uint16_t usedNext;	/**< Next less recently used entry. */
+} ftgxWidthCacheEntry;
+
+/*! \struct ftgxGlyphQuad_
+ * 
+ * Positioned glyph quad awaiting submission to the EFB.
+ */
+typedef struct ftgxGlyphQuad_ {
+	int16_t screenX;		/**< Screen X coordinate of the top left corner of the quad. */
+	int16_t screenY;		/**< Screen Y coordinate of the top left corner of the quad. */
+	uint16_t quadWidth;		/**< Width of the quad in pixels. */
+	uint16_t quadHeight;	/**< Height of the quad in pixels. */
+	GXColor quadColor;		/**< Color applied to the quad. */
+
+	uint16_t texturePage;	/**< Index of the texture atlas page sampled by the quad. */
+	uint16_t glyphIndex;	/**< Glyph slot of the quad less one, used to index the texture coordinate array, or FTGX_GLYPH_UNINDEXED. */
+	f32 textureCoordLeft;	/**< Left S texture coordinate of the quad. */
+	f32 textureCoordTop;	/**< Top T texture coordinate of the quad. */
+	f32 textureCoordRight;	/**< Right S texture coordinate of the quad. */
+	f32 textureCoordBottom;	/**< Bottom T texture coordinate of the quad. */
+} ftgxGlyphQuad;
+
+#ifndef FTGX_TEXTURE_PAGE_SIZE
+#define FTGX_TEXTURE_PAGE_SIZE	256 /**< Default pixel width and height of a texture atlas page. */
+#endif
+
+#ifndef FTGX_WIDTH_CACHE_SIZE
+#define FTGX_WIDTH_CACHE_SIZE	256 /**< Maximum number of text string widths held by the text width cache. */
+#endif
+#define FTGX_WIDTH_CACHE_BUCKETS	(FTGX_WIDTH_CACHE_SIZE * 2) /**< Number of hash buckets of the text width cache. Must be a power of two. */
+#define FTGX_WIDTH_CACHE_NONE		0xffff /**< Entry index value indicating the absence of a text width cache entry. */
+
+#ifndef FTGX_MAX_FONT_SIZES
+#define FTGX_MAX_FONT_SIZES		4 /**< Maximum number of point sizes whose glyph caches are retained at once. */
+#endif
+
+#define FTGX_MAX_BATCH_QUADS	16383 /**< Maximum number of quads which fit into the vertex count of a single GX_Begin call. */
+
+/*! \struct ftgxTextHandle_
+ * 
+ * Text string compiled into a GX display list by compileText.
+ * 
+ * The display list holds the glyph quads of the string relative to its origin and is positioned through a position
+ * matrix when drawn. It is compiled again automatically by drawText should the point size it was compiled from be
+ * released or the vertex format change.
+ */
+typedef struct ftgxTextHandle_ {
+	wchar_t* text;				/**< Copy of the text string. */
+	GXColor textColor;			/**< Color applied to the text characters. */
+	uint16_t textStyle;			/**< Flags which specify any styling applied to the text. */
+
+	uint32_t sizeSerial;		/**< Identifier of the point size the display list was compiled from, or zero if not compiled. */
+	uint8_t vertexIndex;		/**< Vertex format index the display list was compiled for. */
+	bool compactVertices;		/**< Flag indicating that the display list uses the compact vertex format. */
+	uint8_t texCoordDesc;		/**< Texture coordinate vertex descriptor type of the display list. */
+	void* texCoordArray;		/**< Texture coordinate array indexed by the display list. */
+	void* displayList;			/**< 32 byte aligned display list buffer, or NULL if the text has no visible glyphs. */
+	uint32_t displayListSize;	/**< Size of the display list in bytes. */
+
+	uint16_t textWidth;			/**< Pixel width of the text string. */
+	uint16_t printed;			/**< Number of characters printed. */
+} ftgxTextHandle;
+
+/*! \struct ftgxLayoutGlyph_
+ * 
+ * Position of a glyph within a text layout.
+ */
+typedef struct ftgxLayoutGlyph_ {
+	uint16_t glyphSlot;		/**< Glyph slot of the glyph within the point size the layout was computed with. */
+	uint32_t textIndex;		/**< Index of the character within the text string. */
+	int32_t penX;			/**< Pen position of the glyph from the start of its line in 26.6 fixed point pixels of the glyph caches. */
+	int16_t positionX;		/**< X coordinate of the glyph origin relative to the layout origin. */
+	int16_t positionY;		/**< Y coordinate of the glyph baseline relative to the layout origin. */
+} ftgxLayoutGlyph;
+
+/*! \struct ftgxLayoutLine_
+ * 
+ * Line of a text layout.
+ */
+typedef struct ftgxLayoutLine_ {
+	uint32_t textStart;		/**< Index of the first character of the line within the text string. */
+	uint32_t textLength;	/**< Number of characters of the line, excluding the line break and any spaces at which the line was wrapped. */
+	uint32_t glyphStart;	/**< Index of the first glyph of the line within the glyph positions of the layout. */
+	uint32_t glyphCount;	/**< Number of glyphs of the line. */
+	int16_t lineX;			/**< X coordinate of the start of the justified line relative to the layout origin. */
+	int16_t lineY;			/**< Y coordinate of the baseline of the line relative to the layout origin. */
+	uint16_t lineWidth;		/**< Pixel width of the line. */
+} ftgxLayoutLine;
+
+/*! \struct ftgxTextLayout_
+ * 
+ * Text string broken into lines by layoutText.
+ * 
+ * The layout holds the line spans and glyph positions of the string so that a paragraph is only measured and broken once.
+ * It is computed again automatically by drawText should the point size or kerning mode it was computed with change.
+ */
+typedef struct ftgxTextLayout_ {
+	wchar_t* text;				/**< Copy of the text string. */
+	uint16_t wrapWidth;			/**< Maximum pixel width of a line, or zero for no wrapping. */
+	uint16_t textStyle;			/**< Flags which specify any styling applied to the text. */
+	uint16_t lineSpacing;		/**< Pixel distance between the baselines of consecutive lines, or zero for the line height of the font. */
+
+	uint32_t sizeSerial;		/**< Identifier of the point size the layout was computed with, or zero if not computed. */
+	FT_UInt renderSize;			/**< Requested point size the layout was computed with. */
+	bool kerningEnabled;		/**< Flag indicating that the layout was computed with kerning. */
+
+	std::vector<ftgxLayoutLine> lines;		/**< Lines of the layout. */
+	std::vector<ftgxLayoutGlyph> glyphs;	/**< Positions of the glyphs of all lines. */
+	uint16_t layoutWidth;		/**< Pixel width of the widest line. */
+	uint16_t layoutHeight;		/**< Pixel height of the lines. */
+} ftgxTextLayout;
+
+/*! \struct ftgxPreparedGlyph_
+ * 
+ * Resolved glyph of prepared text.
+ */
+typedef struct ftgxPreparedGlyph_ {
+	uint16_t glyphSlot;		/**< Glyph slot of the glyph within the point size the text was prepared with. */
+	int32_t penX;			/**< Pen position of the glyph from the text origin in 26.6 fixed point pixels of the glyph caches. */
+} ftgxPreparedGlyph;
+
+/*! \struct ftgxPreparedText_
+ * 
+ * Text string shaped once by prepareText.
+ * 
+ * Prepared text holds the resolved glyph slots and pen positions of the string in a contiguous array together with the
+ * offsets resulting from its styling and its bounding box, so that drawing it only streams glyph quads. It is prepared
+ * again automatically by drawText should the point size or kerning mode it was prepared with change.
+ */
+typedef struct ftgxPreparedText_ {
+	wchar_t* text;				/**< Copy of the text string. */
+	uint16_t textStyle;			/**< Flags which specify any styling applied to the text. */
+
+	uint32_t sizeSerial;		/**< Identifier of the point size the text was prepared with, or zero if not prepared. */
+	FT_UInt renderSize;			/**< Requested point size the text was prepared with. */
+	bool kerningEnabled;		/**< Flag indicating that the text was prepared with kerning. */
+
+	std::vector<ftgxPreparedGlyph> glyphs;	/**< Resolved glyphs of the text. */
+	uint16_t textWidth;			/**< Pixel width of the text string. */
+	int16_t originX;			/**< X coordinate of the text origin relative to the drawing position after justification. */
+	int16_t originY;			/**< Y coordinate of the text baseline relative to the drawing position after alignment. */
+	int16_t boundsLeft;			/**< X coordinate of the left edge of the glyph bounding box relative to the drawing position. */
+	int16_t boundsTop;			/**< Y coordinate of the top edge of the glyph bounding box relative to the drawing position. */
+	uint16_t boundsWidth;		/**< Pixel width of the glyph bounding box. */
+	uint16_t boundsHeight;		/**< Pixel height of the glyph bounding box. */
+} ftgxPreparedText;
+
+#ifndef FTGX_TEXT_POSMTX
+#define FTGX_TEXT_POSMTX		GX_PNMTX9 /**< Position matrix slot used to position compiled text. */
+#endif
+#ifndef FTGX_DEFAULT_POSMTX
+#define FTGX_DEFAULT_POSMTX		GX_PNMTX0 /**< Position matrix slot made current again after drawing compiled text. */
+#endif
+
+/*! \struct ftgxQueuedQuad_
+ * 
+ * Glyph or text feature quad awaiting submission by flush.
+ */
+typedef struct ftgxQueuedQuad_ {
+	ftgxGlyphQuad glyphQuad;	/**< The quad. */
+	ftgxFontSize* fontSize;		/**< Point size whose texture atlas the quad samples. */
+} ftgxQueuedQuad;
+
+/*! \struct ftgxTextReader_
+ * 
+ * Cursor reading the characters of a wide or UTF-8 text string in place.
+ */
+typedef struct ftgxTextReader_ {
+	const wchar_t* wideText;	/**< Next character of the wide text string, or NULL if reading UTF-8 text. */
+	const uint8_t* utf8Text;	/**< Next byte of the UTF-8 text string. */
+	const uint8_t* utf8End;		/**< End of the UTF-8 text string, or NULL if it is NULL terminated. */
+} ftgxTextReader;
+
+#define FTGX_TEXT_TERMINATED	0xffffffff /**< Text length indicating that the text string is NULL terminated. */
+
+#ifndef FTGX_FORMAT_BUFFER_SIZE
+#define FTGX_FORMAT_BUFFER_SIZE	128 /**< Size in bytes of the stack buffer into which drawTextf formats text. */
+#endif
+#define FTGX_NUMBER_BUFFER_SIZE	24 /**< Size in bytes of the stack buffer into which numbers are formatted. */
+
+#define FTGX_GLYPH_UNINDEXED		0xffff /**< Glyph index of a quad whose texture coordinates are not held in the texture coordinate array, such as quads trimmed by the clip rectangle or subpixel phase variants. */
+
+#define FTGX_SUBPIXEL_MAX_PHASES	4 /**< Maximum number of horizontal subpixel phases. */
+
+#ifndef FTGX_SUBPIXEL_MEMORY_LIMIT
+#define FTGX_SUBPIXEL_MEMORY_LIMIT	(512 * 1024) /**< Maximum texture memory in bytes used by the subpixel phase variants of each point size. */
+#endif
+
+#define FTGX_GX_STATE_UNKNOWN	0xff /**< Shadowed GX state value indicating that the state has not been set during the current draw call. */
+#define FTGX_TEVOP_KONST		0xfe /**< Shadowed TEV operation modulating the texture by the constant color register. */
+#define FTGX_TEVOP_DISTANCE_FIELD	0xfd /**< Shadowed TEV operation thresholding a distance field texture, colored by the vertex color. */
+#define FTGX_TEVOP_DISTANCE_FIELD_KONST	0xfc /**< Shadowed TEV operation thresholding a distance field texture, colored by the constant color register. */
+
+#define FTGX_COMPACT_TEXCOORD_FRAC	15 /**< Fractional bits of the 16-bit texture coordinates of the compact vertex format. */
+#define FTGX_TEXCOORD_ARRAY_MIN		64 /**< Initial number of glyph slots held by a texture coordinate array. */
+
 #define _TEXT(t) L ## t /**< Unicode helper macro. */
 #define EXPLODE_UINT8_TO_UINT32(x) (x << 24) | (x << 16) | (x << 8) | x
 
@@ -186,6 +681,9 @@ typedef struct ftgxCharData_ {
 #define FTGX_STYLE_UNDERLINE	0x0100
 #define FTGX_STYLE_STRIKE		0x0200
 
+#define FTGX_REPLACEMENT_NOTDEF	0x0000	/**< Render unsupported characters with the font's undefined character glyph. */
+#define FTGX_REPLACEMENT_NONE	0xffff	/**< Skip unsupported characters entirely. */
+
 #define FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_MODULATE	0X0001
 #define FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_DECAL		0X0002
 #define FTGX_COMPATIBILITY_DEFAULT_TEVOP_GX_BLEND		0X0004
@@ -206,7 +704,7 @@ const GXColor ftgxWhite = (GXColor){0xff, 0xff, 0xff, 0xff}; /**< Constant color
 /*! \class FreeTypeGX
  * \brief Wrapper class for the FreeType library with GX rendering.
  * \author Armin Tamzarian
- * \version 0.3.2
+ * \version 0.4.0
  * 
  * FreeTypeGX acts as a wrapper class for the FreeType library. It supports precaching of transformed glyph data into
  * a specified texture format. Rendering of the data to the EFB is accomplished through the application of high performance
@@ -218,40 +716,144 @@ class FreeTypeGX {
 		FT_Library ftLibrary;		/**< FreeType FT_Library instance. */
 		FT_Byte * ftFontBuffer;		/**< Pointer to the current font buffer */
 		FT_Long ftFontBufferSize;	/**< Size of the current font buffer */
-		FT_UInt ftPointSize;		/**< Requested size of the rendered font. */
-		FT_Short ftAscender;		/**< Ascender value of the rendered font. */
-		FT_Short ftDescender;		/**< Descender value of the rendered font. */
 
 		bool ftKerningEnabled;		/**< Flag indicating the availability of font kerning data. */
 		FT_Face ftFace;				/**< Reusable FreeType FT_Face object. */
+		FT_UInt ftLoadedGlyph;		/**< Index of the glyph currently held by the glyph slot of the font face. */
+		uint8_t cacheThreadCount;	/**< Number of worker threads used to cache the complete character set, or zero for one per processor. */
 		
 		uint8_t textureFormat;		/**< Defined texture format of the target EFB. */
 		uint8_t vertexIndex;		/**< Vertex format descriptor index. */
 		uint32_t compatibilityMode;	/**< Compatibility mode for default tev operations and vertex descriptors. */	
-		std::map<wchar_t, ftgxCharData> fontData; /**< Map which holds the glyph data structures for the corresponding characters. */
-
-		bool widthCachingEnabled;
-		std::map<const wchar_t*, uint16_t> cacheTextWidth;
+		uint8_t gxTevOp;			/**< TEV operation of stage 0 set during the current draw call. */
+		uint8_t gxTexDesc;			/**< Texture coordinate vertex descriptor set during the current draw call. */
+		uint8_t gxClrDesc;			/**< Color vertex descriptor set during the current draw call. */
+		uint32_t* gxTexData;		/**< Texture data of the atlas page loaded into texture map 0 during the current draw call. */
+		bool gxTexCacheDirty;		/**< Flag indicating that atlas page data has changed since the texture cache was last invalidated. */
+		bool compactVertices;		/**< Flag indicating that glyph quads use the compact vertex format. */
+		Mtx textViewMatrix;			/**< View matrix concatenated with the position of compiled text. */
+		bool indexedTexCoords;		/**< Flag indicating that glyph quads index the texture coordinate array instead of sending texture coordinates. */
+		bool deferredRendering;		/**< Flag indicating that drawText queues quads for submission by flush. */
+		std::vector<ftgxQueuedQuad> textQueue;	/**< Quads queued for submission by flush. */
+		bool clipEnabled;			/**< Flag indicating that text is clipped to the clip rectangle. */
+		int16_t clipLeft;			/**< Left screen X coordinate of the clip rectangle. */
+		int16_t clipTop;			/**< Top screen Y coordinate of the clip rectangle. */
+		int16_t clipRight;			/**< Screen X coordinate immediately right of the clip rectangle. */
+		int16_t clipBottom;			/**< Screen Y coordinate immediately below the clip rectangle. */
+		bool distanceFieldEnabled;	/**< Flag indicating that glyphs are rendered once as distance fields and scaled to each point size. */
+		FT_UInt renderSize;			/**< Point size requested through setSize, which differs from that of the active glyph caches for distance field glyphs. */
+		f32 renderScale;			/**< Scale from the metrics of the active glyph caches to the requested point size. */
+		uint8_t subpixelPhases;		/**< Number of horizontal subpixel phases at which glyphs of new point sizes are rendered. */
+		std::vector<ftgxFontSize*> fontSizes;	/**< Glyph caches of each point size of the font face. */
+		ftgxFontSize *fontSize;		/**< Glyph caches of the active point size. */
+		uint32_t fontSizeActivations;	/**< Number of point size activations used to order the point sizes by recent use. */
+		uint32_t fontSizeSerials;	/**< Number of point sizes created, used to identify each point size. */
+		wchar_t replacementCharacter;	/**< Character rendered in place of characters unsupported by the font. */
+		std::vector<ftgxGlyphQuad> glyphBatch; /**< Glyph quads of the current string awaiting submission. */
+
+		bool widthCachingEnabled;	/**< Flag indicating that text widths should be cached. */
+		ftgxWidthCacheEntry widthCache[FTGX_WIDTH_CACHE_SIZE];	/**< Text width cache entries. */
+		uint16_t widthCacheBuckets[FTGX_WIDTH_CACHE_BUCKETS];	/**< First text width cache entry of each hash bucket. */
+		uint16_t widthCacheCount;	/**< Number of text width cache entries in use. */
+		uint16_t widthCacheFirst;	/**< Most recently used text width cache entry. */
+		uint16_t widthCacheLast;	/**< Least recently used text width cache entry. */
+
+		bool asyncCachingEnabled;	/**< Flag indicating that glyph textures are rendered by the asynchronous caching thread. */
+		bool asyncThreadRunning;	/**< Flag indicating that the asynchronous caching thread has been started. */
+		bool asyncThreadStop;		/**< Flag requesting the asynchronous caching thread to exit. */
+		bool asyncThreadFailed;		/**< Flag indicating that the asynchronous caching thread could not create its font face. */
+		ftgxThread asyncThread;		/**< Asynchronous caching thread. */
+		ftgxMutex asyncMutex;		/**< Mutex guarding the asynchronous caching queues. */
+		ftgxCond asyncCond;			/**< Condition signalled when a glyph is added to the request queue. */
+		std::deque<ftgxAsyncGlyph> asyncRequests;	/**< Glyphs awaiting rendering by the asynchronous caching thread. */
+		std::deque<ftgxAsyncGlyph> asyncCompleted;	/**< Glyphs rendered by the asynchronous caching thread awaiting loading into the texture atlas. */
+
+		std::vector<uint32_t> precacheChars;	/**< Characters of the incremental precache in progress. */
+		uint32_t precacheIndex;		/**< Number of characters of the incremental precache already cached. */
 
 		static uint16_t maxVideoWidth; /**< Maximum width of the video screen. */
 
 		static uint16_t adjustTextureWidth(uint16_t textureWidth, uint8_t textureFormat);
 		static uint16_t adjustTextureHeight(uint16_t textureHeight, uint8_t textureFormat);
+		static uint32_t getTextureSize(uint16_t textureWidth, uint16_t textureHeight, uint8_t textureFormat);
 
 		uint16_t getStyleOffsetWidth(uint16_t width, uint16_t format);
 		uint16_t getStyleOffsetHeight(uint16_t format);
+		uint16_t getCachedWidth(wchar_t *text);
+		uint16_t measureWidth(ftgxTextReader reader);
+		uint16_t measureHeight(ftgxTextReader reader);
+		static uint32_t hashText(wchar_t *text, uint32_t *length);
 		ftgxCharData* getCharacter(wchar_t character);
+		ftgxCharTexture* getCharacterTexture(ftgxCharData *charData);
+		ftgxCharTexture* getPhaseTexture(ftgxCharData *charData, ftgxCharTexture *charTexture, uint8_t phase);
+		void cachePhaseTexture(ftgxCharData *charData, ftgxCharTexture *charTexture, ftgxCharTexture *phaseTexture, uint8_t phase);
+		ftgxCharData* getReplacementGlyph();
+		uint16_t getSolidSlot();
+
+		uint16_t findGlyphSlot(wchar_t character);
+		uint16_t* allocateGlyphSlot(wchar_t character);
+		void clearGlyphTable(ftgxGlyphTable *glyphTable);
 
 		void unloadFont();
+		ftgxFontSize* createFontSize(FT_UInt pointSize);
+		void unloadFontSize(ftgxFontSize *size);
+		bool hasKerning();
+		void loadKerningTable();
+		int16_t getKerning(FT_UInt leftIndex, FT_UInt rightIndex);
 		ftgxCharData *cacheGlyphData(wchar_t charCode);
+		uint16_t cacheGlyphIndex(FT_UInt gIndex);
+		void cacheGlyphTexture(ftgxCharData *charData, ftgxCharTexture *charTexture);
+		bool loadGlyph(FT_UInt gIndex);
 		uint16_t cacheGlyphDataComplete();
-		void loadGlyphData(FT_Bitmap *bmp, ftgxCharData *charData);
+		uint16_t cacheGlyphDataParallel(uint8_t threadCount);
+		uint16_t cacheRasterBatch(ftgxRasterGlyph *glyphs, uint32_t glyphCount, uint8_t threadCount);
+		static void* rasterGlyphShard(void *shard);
+		void loadGlyphData(FT_Bitmap *bmp, ftgxCharTexture *charTexture);
+		bool queueGlyphTexture(ftgxCharData *charData);
+		void publishAsyncGlyphs();
+		void stopAsyncCaching();
+		static void* asyncCachingThread(void *instance);
+		void processAsyncRequests();
+		static uint32_t* convertGlyphBitmap(FT_Bitmap *bmp, uint16_t textureWidth, uint16_t textureHeight, uint8_t textureFormat);
+		static void createDistanceField(FT_Bitmap *bmp, uint16_t spread, FT_Bitmap *field);
+		int16_t scaleMetric(int32_t value);
+		int32_t scalePosition(int32_t position);
+		int16_t snapPosition(int32_t position, uint8_t *phase);
+		uint16_t allocateTextureRegion(uint16_t width, uint16_t height, uint16_t *x, uint16_t *y);
+		void copyTextureToPage(uint32_t *glyphTexture, ftgxCharTexture *charTexture, uint16_t x, uint16_t y);
 
 		void setDefaultMode();
-
-		void drawTextFeature(int16_t x, int16_t y, uint16_t width, uint16_t format, GXColor color);
-		void copyTextureToFramebuffer(GXTexObj *texObj, f32 texWidth, f32 texHeight, int16_t screenX, int16_t screenY, GXColor color);
-		void copyFeatureToFramebuffer(f32 featureWidth, f32 featureHeight, int16_t screenX, int16_t screenY,  GXColor color);
+		void resetState();
+		void setTevOp(uint8_t tevOp);
+		void setTexDesc(uint8_t texDesc);
+		void setClrDesc(uint8_t clrDesc);
+		void setKonstColor(GXColor color);
+		uint8_t getTexCoordDesc(ftgxFontSize *size);
+		bool prepareTexCoordArray(ftgxFontSize *size);
+		void storeTexCoords(ftgxFontSize *size, uint16_t glyphIndex);
+		void setTexCoordArray(void *texCoordArray, bool compact);
+		void loadTexturePage(ftgxTexturePage *page);
+
+		uint16_t drawCharacters(int16_t x, int16_t y, ftgxTextReader reader, GXColor color, uint16_t textStyle);
+		uint16_t drawNumberCharacters(int16_t x, int16_t y, const char *text, uint8_t length, GXColor color, uint16_t textStyle);
+		void resolveNumberGlyphs();
+		bool isTextClipped(int16_t x, int16_t y, uint16_t textStyle);
+		void getStyleOffsets(ftgxTextReader reader, uint16_t textStyle, uint16_t *textWidth, uint16_t *offsetX, uint16_t *offsetY);
+		uint16_t batchGlyphs(int16_t x, int16_t y, ftgxTextReader reader, GXColor color, uint16_t maxX, bool waitForTextures, bool clipGlyphs);
+		void batchGlyph(ftgxCharData *glyphData, int32_t origin, int32_t pen, int16_t y, GXColor color, bool waitForTextures, bool clipGlyphs);
+		bool clipGlyphQuad(ftgxGlyphQuad *quad);
+		ftgxFontSize* getTextHandleSize(ftgxTextHandle *handle);
+		bool buildTextHandle(ftgxTextHandle *handle);
+		bool buildTextLayout(ftgxTextLayout *layout);
+		bool buildPreparedText(ftgxPreparedText *prepared);
+
+		void batchTextFeature(int16_t x, int16_t y, uint16_t width, uint16_t format, GXColor color, bool clipFeatures);
+		void submitGlyphBatch(GXColor color);
+		void flushGlyphBatch(GXColor color);
+		void setGlyphMode(GXColor color, uint8_t texCoordDesc, bool distanceField);
+		void emitGlyphBatch(uint8_t texCoordDesc);
+		bool isSameQueueRun(ftgxQueuedQuad *a, ftgxQueuedQuad *b, bool preserveOrder);
+		void copyTextureToFramebuffer(ftgxTexturePage *page, ftgxGlyphQuad *quads, uint16_t quadCount, uint8_t texCoordDesc);
 		
 	public:
 		FreeTypeGX(uint8_t textureFormat = GX_TF_RGBA8, uint8_t vertexIndex = GX_VTXFMT1);
@@ -262,23 +864,77 @@ class FreeTypeGX {
 		bool setTextWidthCachingEnabled(bool enabled);
 		bool getTextWidthCachingEnabled();
 		void clearTextWidthCache();
+		void setReplacementCharacter(wchar_t character);
+		wchar_t getReplacementCharacter();
+		uint8_t setCacheThreadCount(uint8_t threadCount);
+		uint8_t getCacheThreadCount();
+		bool setAsyncCachingEnabled(bool enabled);
+		bool getAsyncCachingEnabled();
+		uint32_t getAsyncPendingCount();
+		uint32_t beginPrecache(wchar_t *charset = NULL);
+		uint32_t beginPrecache(wchar_t const *charset);
+		bool precacheStep(uint32_t microsecondBudget);
+		f32 getPrecacheProgress();
 
 		static wchar_t* charToWideChar(char* p);
 		static wchar_t* charToWideChar(const char* p);
 		void setVertexFormat(uint8_t vertexIndex);
+		bool setCompactVerticesEnabled(bool enabled);
+		bool getCompactVerticesEnabled();
+		bool setIndexedTexCoordsEnabled(bool enabled);
+		bool getIndexedTexCoordsEnabled();
+		bool setDeferredRenderingEnabled(bool enabled);
+		bool getDeferredRenderingEnabled();
+		bool setDistanceFieldEnabled(bool enabled);
+		bool getDistanceFieldEnabled();
+		uint8_t setSubpixelPhases(uint8_t phases);
+		uint8_t getSubpixelPhases();
+		uint32_t getSubpixelMemoryUsage();
+		void flush(bool preserveOrder = false);
 		void setCompatibilityMode(uint32_t compatibilityMode);
 		static uint16_t setMaxVideoWidth(uint16_t width);
+		void setClipRect(int16_t x, int16_t y, uint16_t width, uint16_t height);
+		void clearClipRect();
+		bool getClipRect(int16_t *x, int16_t *y, uint16_t *width, uint16_t *height);
 
 		uint16_t loadFont(uint8_t* fontBuffer, FT_Long bufferSize, FT_UInt pointSize, bool cacheAll = false);
 		uint16_t loadFont(const uint8_t* fontBuffer, FT_Long bufferSize, FT_UInt pointSize, bool cacheAll = false);
+		bool setSize(FT_UInt pointSize);
+		FT_UInt getSize();
+
+		bool loadFontCache(uint8_t* cacheBuffer, uint32_t bufferSize);
+		bool loadFontCache(const uint8_t* cacheBuffer, uint32_t bufferSize);
+		uint32_t saveFontCache(uint8_t* cacheBuffer, uint32_t bufferSize);
 		
 		uint16_t drawText(int16_t x, int16_t y, wchar_t *text, GXColor color = ftgxWhite, uint16_t textStyling = FTGX_NULL);
 		uint16_t drawText(int16_t x, int16_t y, wchar_t const *text, GXColor color = ftgxWhite, uint16_t textStyling = FTGX_NULL);
+		uint16_t drawText(int16_t x, int16_t y, const char *text, GXColor color = ftgxWhite, uint16_t textStyling = FTGX_NULL, uint32_t length = FTGX_TEXT_TERMINATED);
+		uint16_t drawText(int16_t x, int16_t y, ftgxTextHandle *handle);
+		uint16_t drawText(int16_t x, int16_t y, ftgxTextLayout *layout, GXColor color = ftgxWhite);
+		uint16_t drawText(int16_t x, int16_t y, ftgxPreparedText *prepared, GXColor color = ftgxWhite);
+		uint16_t drawTextf(int16_t x, int16_t y, GXColor color, uint16_t textStyling, const char *format, ...) __attribute__((format(printf, 6, 7)));
+		uint16_t drawNumber(int16_t x, int16_t y, int32_t value, GXColor color = ftgxWhite, uint16_t textStyling = FTGX_NULL, uint8_t minDigits = 1);
+		uint16_t drawFixed(int16_t x, int16_t y, int32_t value, uint8_t fractionBits, uint8_t decimals, GXColor color = ftgxWhite, uint16_t textStyling = FTGX_NULL);
+
+		ftgxTextHandle* compileText(wchar_t *text, GXColor color = ftgxWhite, uint16_t textStyling = FTGX_NULL);
+		ftgxTextHandle* compileText(wchar_t const *text, GXColor color = ftgxWhite, uint16_t textStyling = FTGX_NULL);
+		void releaseText(ftgxTextHandle *handle);
+		void setTextViewMatrix(Mtx viewMatrix);
+
+		ftgxTextLayout* layoutText(wchar_t *text, uint16_t wrapWidth = 0, uint16_t textStyling = FTGX_NULL, uint16_t lineSpacing = 0);
+		ftgxTextLayout* layoutText(wchar_t const *text, uint16_t wrapWidth = 0, uint16_t textStyling = FTGX_NULL, uint16_t lineSpacing = 0);
+		void releaseLayout(ftgxTextLayout *layout);
+
+		ftgxPreparedText* prepareText(wchar_t *text, uint16_t textStyling = FTGX_NULL);
+		ftgxPreparedText* prepareText(wchar_t const *text, uint16_t textStyling = FTGX_NULL);
+		void releasePreparedText(ftgxPreparedText *prepared);
 
 		uint16_t getWidth(wchar_t *text);
 		uint16_t getWidth(wchar_t const *text);
+		uint16_t getWidth(const char *text, uint32_t length = FTGX_TEXT_TERMINATED);
 		uint16_t getHeight(wchar_t *text);
 		uint16_t getHeight(wchar_t const *text);
+		uint16_t getHeight(const char *text, uint32_t length = FTGX_TEXT_TERMINATED);
 };
 
 #endif /* FREETYPEGX_H_ */
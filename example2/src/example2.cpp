@@ -95,10 +95,10 @@ int main(int argc, char **argv) {
 	while(!padSystem->pressedExitButton(buttons = padSystem->scanPads(0))) {
 
 		if(padSystem->pressedUp(buttons)) {	// Increase font size
-			fontSystem->loadFont(rursus_compact_mono_ttf, rursus_compact_mono_ttf_size, ++fontSize, false);
+			fontSystem->setSize(++fontSize);
 		}
 		if(padSystem->pressedDown(buttons)) {	// Decrease font size
-			fontSystem->loadFont(rursus_compact_mono_ttf, rursus_compact_mono_ttf_size, fontSize > 6 ? --fontSize : fontSize, false);
+			fontSystem->setSize(fontSize > 6 ? --fontSize : fontSize);
 		}
 		if(padSystem->pressedLeft(buttons)) {	// Toggle text underlining
 			isUnderlined = !isUnderlined;